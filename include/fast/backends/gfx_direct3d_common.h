@@ -7,6 +7,8 @@
 #include "../interpreter.h"
 #include <cstdint>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "gfx_rendering_api.h"
 #include "d3d11.h"
 #include "d3dcompiler.h"
@@ -175,6 +177,14 @@ class GfxRenderingAPIDX11 final : public GfxRenderingAPI {
     void CreateDepthStencilObjects(uint32_t width, uint32_t height, uint32_t msaa_count, ID3D11DepthStencilView** view,
                                    ID3D11ShaderResourceView** srv);
 
+    /**
+     * @brief Gives @p textureData a texture and view sized @p width x @p height.
+     *
+     * The previous pair is kept for a later texture of its size, and a kept pair of the requested size is
+     * reused before creating a new one.
+     */
+    void ReplaceTextureStorage(TextureData& textureData, uint32_t width, uint32_t height);
+
     HMODULE mDX11Module;
 
     HMODULE mCompilerModule;
@@ -185,6 +195,8 @@ class GfxRenderingAPIDX11 final : public GfxRenderingAPI {
     Microsoft::WRL::ComPtr<ID3D11RasterizerState> mRasterizerState;
     Microsoft::WRL::ComPtr<ID3D11DepthStencilState> mDepthStencilState;
     Microsoft::WRL::ComPtr<ID3D11Buffer> mVertexBuffer;
+    // Byte offset in mVertexBuffer where the next batch's vertices are written.
+    size_t mVertexBufferOffset = 0;
     Microsoft::WRL::ComPtr<ID3D11Buffer> mPerFrameCb;
     Microsoft::WRL::ComPtr<ID3D11Buffer> mPerDrawCb;
     Microsoft::WRL::ComPtr<ID3D11Buffer> mPerPrimDepthCb;
@@ -209,6 +221,8 @@ class GfxRenderingAPIDX11 final : public GfxRenderingAPI {
     std::map<std::pair<uint64_t, uint32_t>, struct ShaderProgramD3D11> mShaderProgramPool;
 
     std::vector<struct TextureData> mTextures;
+    // Texture/view pairs detached from their id by a size change, keyed by (width << 16 | height).
+    std::unordered_map<uint32_t, std::vector<TextureData>> mSpareTextures;
     int mCurrentTile;
     uint32_t mCurrentTextureIds[SHADER_MAX_TEXTURES] = {};
 
@@ -217,6 +217,10 @@ class GfxRenderingAPIMetal final : public GfxRenderingAPI {
   private:
     bool NonUniformThreadGroupSupported();
     void SetupScreenFramebuffer(uint32_t width, uint32_t height);
+    /** @brief Returns a texture of the given size, reusing a parked one when available. */
+    MTL::Texture* AcquireTexture(uint32_t width, uint32_t height);
+    /** @brief Keeps a texture detached from its id for reuse by a later texture of the same size. */
+    void ParkTexture(MTL::Texture* texture);
     // Elements that only need to be setup once
     SDL_Renderer* mRenderer;
     CA::MetalLayer* mLayer; // CA::MetalLayer*
@@ -230,6 +234,8 @@ class GfxRenderingAPIMetal final : public GfxRenderingAPI {
         mShaderProgramPool;
 
     std::vector<struct TextureDataMetal> mTextures;
+    // Textures detached from their id by a size change, keyed by (width << 16 | height).
+    std::unordered_map<uint32_t, std::vector<MTL::Texture*>> mSpareTextures;
     std::vector<FramebufferMetal> mFramebuffers;
     FrameUniforms mFrameUniforms;
     CoordUniforms mCoordUniforms;
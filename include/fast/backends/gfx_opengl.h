@@ -1,7 +1,10 @@
 #ifdef ENABLE_OPENGL
 #pragma once
 
+#include <limits>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include "gfx_rendering_api.h"
 #include "../interpreter.h"
 
@@ -34,6 +37,21 @@ class ResourceManager;
 #include <SDL3/SDL_opengl.h>
 #endif
 namespace Fast {
+/**
+ * @brief Uniform values last uploaded to a shader program.
+ *
+ * GL keeps uniform values per program, so values that did not change since the program was
+ * last used can be skipped. The initial values never match real ones, forcing a first upload.
+ */
+struct ShaderUniformCache {
+    int64_t frameCount = -1;
+    float noiseScale = std::numeric_limits<float>::quiet_NaN();
+    float primDepth = std::numeric_limits<float>::quiet_NaN();
+    GLint textureFiltering[2] = { -1, -1 };
+    GLint textureWidth[2] = { -1, -1 };
+    GLint textureHeight[2] = { -1, -1 };
+};
+
 /**
  * @brief OpenGL shader program metadata cached by the Fast3D renderer.
  */
@@ -51,6 +69,7 @@ struct ShaderProgram {
     GLint texture_width_location;
     GLint texture_height_location;
     GLint texture_filtering_location;
+    ShaderUniformCache uniforms;
 };
 
 /**
@@ -63,15 +82,24 @@ struct FramebufferOGL {
     bool invertY;
 
     GLuint fbo, clrbuf, clrbufMsaa, rbo;
+    /** @brief Texture id under which clrbuf can be selected for sampling. */
+    uint32_t texture_id;
 };
 
 /**
  * @brief Cached texture metadata tracked per texture id.
  */
 struct TextureInfo {
+    /** @brief GL texture object currently backing the id; 0 until the first upload. */
+    GLuint object;
+    /** @brief Dimensions of the storage allocated for object. */
     uint16_t width;
     uint16_t height;
     uint16_t filtering;
+    /** @brief Sampler object bound alongside the texture; 0 samples with the texture's own parameters. */
+    GLuint sampler;
+    /** @brief Packed filter and wrap modes the texture is sampled with; indexes the sampler object cache. */
+    uint8_t samplerKey;
 };
 
 /**
@@ -131,16 +159,50 @@ class GfxRenderingAPIOGL final : public GfxRenderingAPI {
     FilteringMode GetTextureFilter() override;
     void SetSrgbMode() override;
     ImTextureID GetTextureById(int id) override;
+    GfxStateCallStats GetStateCallStats() override;
     /** @} */
   private:
-    void SetUniforms(ShaderProgram* prg) const;
+    void SetUniforms(ShaderProgram* prg);
     std::string BuildFsShader(const CCFeatures& cc_features);
     void SetPerDrawUniforms();
 
+    /**
+     * @brief Counts a filtered state call and returns @p isChanged.
+     *
+     * Every GL state change goes through this so redundant calls can be told apart from issued ones.
+     */
+    bool ShouldIssue(bool isChanged);
+    GLuint GetSampler(uint8_t samplerKey);
+    void BindSampler(int unit, GLuint sampler);
+    /** @brief Fallback without sampler objects: applies @p samplerKey to the texture bound on the active unit. */
+    void SetTextureParameters(uint8_t samplerKey);
+    void SetScissorTest(bool isEnabled);
+    void SetScissorBox(GLint x, GLint y, GLint width, GLint height);
+    void SetDepthMask(bool isEnabled);
+    void BindTexture(int unit, GLuint object);
+
+    /**
+     * @brief Points @p info at a texture object with storage for @p width x @p height texels.
+     *
+     * The previous object is parked for reuse by a later texture of its size, and a parked object of the
+     * requested size is taken before allocating new storage.
+     */
+    void ReplaceTextureStorage(TextureInfo& info, uint32_t width, uint32_t height);
+    void ParkTextureObject(GLuint object, uint32_t width, uint32_t height);
+
     std::shared_ptr<Ship::ConsoleVariable> mConsoleVariable;
     std::shared_ptr<Ship::ResourceManager> mResourceManager;
 
+    // Indexed by texture id; ids are decoupled from GL names so a resized texture can swap its object.
     std::vector<TextureInfo> textures;
+    std::vector<uint32_t> mFreeTextureIds;
+    // Texture objects detached from their id by a size change, keyed by (width << 16 | height).
+    std::unordered_map<uint32_t, std::vector<GLuint>> mSpareTextures;
+    bool mHasTextureStorage = false;
+    // Sampler objects need OpenGL 3.3 or ARB_sampler_objects; without them sampling state lives on each texture.
+    bool mHasSamplerObjects = false;
+    // glMapBufferRange needs OpenGL 3.0 or ARB_map_buffer_range; without it vertices stream through glBufferSubData.
+    bool mHasMapBufferRange = false;
     GLuint mCurrentTextureIds[SHADER_MAX_TEXTURES] = {};
     GLuint mLastBoundTextures[SHADER_MAX_TEXTURES] = {};
     uint8_t mCurrentTile;
@@ -148,11 +210,29 @@ class GfxRenderingAPIOGL final : public GfxRenderingAPI {
     int8_t mLastBlendEnabled = -1;
     int8_t mLastScissorEnabled = -1;
 
+    // Shadow of the GL state set below; -1 / 0 entries mean the state is unknown.
+    GLuint mLastBoundSamplers[SHADER_MAX_TEXTURES] = {};
+    int8_t mLastDepthTestEnabled = -1;
+    int8_t mLastDepthMaskEnabled = -1;
+    GLenum mLastDepthFunc = 0;
+    int8_t mLastPolygonOffsetEnabled = -1;
+    GLfloat mLastPolygonOffset[2] = { 0.0f, 0.0f };
+    GLint mLastViewport[4] = { -1, -1, -1, -1 };
+    GLint mLastScissor[4] = { -1, -1, -1, -1 };
+
+    // One sampler object per (filter, wrap S, wrap T) combination, created on first use.
+    GLuint mSamplers[2 * 4 * 4] = {};
+
+    GfxStateCallStats mStateCalls;
+    GfxStateCallStats mLastFrameStateCalls;
+
     std::map<std::pair<uint64_t, uint32_t>, ShaderProgram> mShaderProgramPool;
     ShaderProgram* mCurrentShaderProgram;
     ShaderProgram* mLastLoadedShader = nullptr;
 
     GLuint mOpenglVbo = 0;
+    // Byte offset in mOpenglVbo where the next batch's vertices are written.
+    size_t mVertexBufferOffset = 0;
 #if defined(__APPLE__) || defined(USE_OPENGLES)
     GLuint mOpenglVao;
 #endif
@@ -16,6 +16,14 @@ struct GfxClipParameters {
 
 enum FilteringMode { FILTER_THREE_POINT, FILTER_LINEAR, FILTER_NONE };
 
+/**
+ * @brief Per-frame count of graphics-API state calls a backend issued versus skipped as redundant.
+ */
+struct GfxStateCallStats {
+    uint32_t Issued = 0;
+    uint32_t Skipped = 0;
+};
+
 // A hash function used to hash a: pair<float, float>
 struct hash_pair_ff {
     size_t operator()(const std::pair<float, float>& p) const {
@@ -79,6 +87,10 @@ class GfxRenderingAPI {
     virtual void SetSrgbMode() = 0;
     virtual ImTextureID GetTextureById(int id) = 0;
     virtual void SetCurrentPrimDepth(float depth) = 0;
+    /** @brief Returns the state-call counters of the last completed frame, if the backend tracks them. */
+    virtual GfxStateCallStats GetStateCallStats() {
+        return {};
+    }
 
   protected:
     int8_t mCurrentDepthTest = 0;
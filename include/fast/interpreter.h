@@ -359,7 +359,10 @@ struct RenderingState {
     bool alpha_blend;
     struct XYWidthHeight viewport, scissor;
     struct ShaderProgram* mShaderProgram;
+    uint16_t prim_depth; // prim depth of the queued triangles, when their shader uses it
     TextureCacheNode* mTextures[SHADER_MAX_TEXTURES];
+    // Cache entry whose texture is bound on each slot; nullptr when a framebuffer or unknown texture is.
+    const TextureCacheNode* mBoundTextures[SHADER_MAX_TEXTURES];
 };
 
 struct FBInfo {
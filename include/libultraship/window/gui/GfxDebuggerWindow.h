@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ship/window/gui/GuiWindow.h"
+#include <cstdint>
+#include <string>
 #include <vector>
 #include <memory>
 
@@ -27,6 +29,9 @@ namespace LUS {
  * a single frame's display list and renders an expandable node tree where each
  * node corresponds to one or more graphics microcode commands.
  *
+ * The tree is decoded once per capture (sub display lists on first expansion) into a
+ * flat node array with pre-formatted labels, and only the rows in view are drawn.
+ *
  * The window is registered in the GUI as "Gfx Debugger" and is accessible via
  * Gui::GetGuiWindow("Gfx Debugger").
  */
@@ -49,25 +54,63 @@ class GfxDebuggerWindow : public Ship::GuiWindow {
     /** @brief Caches a weak reference to the Fast3D interpreter on first init. */
     void OnInit(const nlohmann::json& initArgs = nlohmann::json::object()) override;
 
-    /** @brief Polls the interpreter for a new display list when debugging is requested. */
+    /** @brief Drops the cached disassembly tree once debugging ends. */
     void UpdateElement() override;
 
     /** @brief Renders the disassembly tree for the captured display list. */
     void DrawElement() override;
 
   private:
+    /** @brief One decoded display-list command in the disassembly tree. */
+    struct DisasNode {
+        const Fast::F3DGfx* Cmd = nullptr;
+        const Fast::F3DGfx* Sub = nullptr; ///< Display list this command calls, or nullptr.
+        std::string Label;                 ///< "address: index: text", formatted once at decode time.
+        size_t TextOffset = 0;             ///< Start of the command text within Label.
+        int32_t Parent = -1;
+        uint32_t Depth = 0;
+        uint32_t FirstChild = 0; ///< Children are contiguous in mDisasNodes once decoded.
+        uint32_t ChildCount = 0;
+        bool ChildrenDecoded = false;
+        bool Open = false;
+    };
+
     /**
-     * @brief Recursively renders a single display-list command node.
-     * @param cmd       Pointer to the F3DGfx command to display.
-     * @param gfxPath   Full path from the root to @p cmd (for context/breadcrumbs).
-     * @param parentPosY Y position of the parent node (used for connector lines).
+     * @brief Decodes a display list into nodes appended to mDisasNodes.
+     * @param cmd    First command of the display list.
+     * @param parent Index of the node that calls the display list, or -1 for the root list.
      */
-    void DrawDisasNode(const Fast::F3DGfx* cmd, std::vector<const Fast::F3DGfx*>& gfxPath, float parentPosY) const;
+    void DecodeDisasNodes(const Fast::F3DGfx* cmd, int32_t parent);
+
+    /** @brief Discards the cached tree and decodes the root list of @p dlist (if any). */
+    void BuildDisasTree(const Fast::F3DGfx* dlist);
+
+    /** @brief Opens a node, decoding its sub display list the first time. */
+    void ExpandDisasNode(uint32_t index);
+
+    /** @brief Flattens the open part of the tree into mDisasRows. */
+    void RebuildDisasRows();
+
+    /** @brief Returns the index of the node at the given breakpoint path, or -1 if it is not decoded. */
+    int32_t FindDisasNode(const std::vector<const Fast::F3DGfx*>& path) const;
+
+    /** @brief Returns the breakpoint path from the root to the given node. */
+    std::vector<const Fast::F3DGfx*> GetDisasNodePath(uint32_t index) const;
+
+    /** @brief Renders the visible rows of the cached disassembly tree. */
+    void DrawDisasTree();
 
     /** @brief Renders the top-level disassembly tree for the last captured breakpoint. */
     void DrawDisas();
 
   private:
+    std::vector<DisasNode> mDisasNodes;       ///< Decoded tree; root nodes come first.
+    std::vector<uint32_t> mDisasRows;         ///< Node indices of the expanded tree, in display order.
+    const Fast::F3DGfx* mDisasRoot = nullptr; ///< Display list mDisasNodes was decoded from.
+    uint32_t mDisasRootCount = 0;
+    int32_t mSelectedDisasNode = -1;
+    bool mDisasRowsDirty = true;
+
     std::vector<const Fast::F3DGfx*> mLastBreakPoint = {}; ///< Last captured display list command buffer.
     std::weak_ptr<Fast::Interpreter> mInterpreter; ///< Weak reference to the Fast3D interpreter (constructor-injected).
     std::shared_ptr<Fast::GfxDebugger> mGfxDebugger;         ///< GfxDebugger component (constructor-injected).
@@ -1,9 +1,11 @@
 #pragma once
 #include "stdint.h"
 #include "stddef.h"
+#include <atomic>
 #include <string>
 #include <memory>
 #include "ship/audio/AudioChannelsSetting.h"
+#include "ship/audio/AudioRingBuffer.h"
 #include "ship/audio/SoundMatrixDecoder.h"
 
 namespace Ship {
@@ -14,9 +16,10 @@ namespace Ship {
 struct AudioSettings {
     int32_t SampleRate = 44100;     ///< Output sample rate in Hz.
     int32_t SampleLength = 1024;    ///< Number of samples per audio frame.
-    int32_t DesiredBuffered = 2480; ///< Target number of frames to keep buffered.
+    int32_t DesiredBuffered = 2480; ///< Initial target number of frames to keep buffered.
     AudioChannelsSetting ChannelSetting =
         AudioChannelsSetting::audioStereo; ///< Channel mode (stereo / 5.1 matrix / 5.1 raw).
+    bool AdaptiveBuffering = true; ///< Let the player move DesiredBuffered based on underruns and drops.
 };
 
 /**
@@ -24,9 +27,17 @@ struct AudioSettings {
  *
  * AudioPlayer owns the audio device lifecycle (DoInit / DoClose) and the optional
  * SoundMatrixDecoder that converts stereo input to 5.1 surround. Concrete
- * subclasses implement DoInit(), DoClose(), and DoPlay() for each supported platform
+ * subclasses implement DoInit() and DoClose() for each supported platform
  * (SDL3, CoreAudio, WASAPI, or a null no-op).
  *
+ * Play() writes into a lock-free single-producer / single-consumer AudioRingBuffer
+ * shared by every backend; the backend's device callback pulls from it with
+ * RenderFrames() (or DrainFrames() for push-style devices). The player tracks
+ * underruns and dropped frames and, when AudioSettings::AdaptiveBuffering is set,
+ * moves the desired buffered depth between twice the device period and most of the
+ * ring: it grows by one device period on every underrun and shrinks again after a
+ * run of clean one-second windows, or as soon as a window sees dropped frames.
+ *
  * Obtain the active instance from Context::GetAudio() → Audio::GetAudioPlayer().
  */
 class AudioPlayer {
@@ -36,7 +47,7 @@ class AudioPlayer {
      * @brief Constructs an AudioPlayer with the given configuration.
      * @param settings Sample rate, buffer size, desired buffered frames, and channel mode.
      */
-    AudioPlayer(AudioSettings settings) : mAudioSettings(settings) {
+    AudioPlayer(AudioSettings settings) : mAudioSettings(settings), mTargetBuffered(settings.DesiredBuffered) {
     }
     ~AudioPlayer();
 
@@ -47,12 +58,13 @@ class AudioPlayer {
     bool Init();
 
     /**
-     * @brief Returns the number of audio frames currently queued in the device buffer.
+     * @brief Returns the number of audio frames currently queued for output.
      *
      * The audio system uses this to pace audio production: if Buffered() exceeds
-     * DesiredBuffered the game can skip producing audio for that tick.
+     * DesiredBuffered the game can skip producing audio for that tick. The default
+     * counts frames waiting in the ring; backends add whatever the device itself holds.
      */
-    virtual int32_t Buffered() = 0;
+    virtual int32_t Buffered();
 
     /**
      * @brief Submits a frame of PCM audio to the output device.
@@ -77,9 +89,18 @@ class AudioPlayer {
     /** @brief Returns the configured number of samples per audio frame. */
     int32_t GetSampleLength() const;
 
-    /** @brief Returns the target number of frames to keep buffered. */
+    /** @brief Returns the target number of frames to keep buffered (adapted at runtime if enabled). */
     int32_t GetDesiredBuffered() const;
 
+    /** @brief Returns how many times the device callback ran the ring dry after playback started. */
+    uint64_t GetUnderrunCount() const;
+
+    /** @brief Returns how many frames Play() had to discard because the ring was full. */
+    uint64_t GetDroppedFrameCount() const;
+
+    /** @brief Returns the device period in frames, as reported by the backend or observed in callbacks. */
+    int32_t GetDevicePeriod() const;
+
     /** @brief Returns the current channel-output mode. */
     AudioChannelsSetting GetAudioChannels() const;
 
@@ -97,6 +118,10 @@ class AudioPlayer {
 
     /**
      * @brief Sets the target number of buffered frames.
+     *
+     * With adaptive buffering enabled this is the new starting point; the player keeps
+     * adjusting from there.
+     *
      * @param size New buffered-frame target.
      */
     void SetDesiredBuffered(int32_t size);
@@ -136,21 +161,94 @@ class AudioPlayer {
     virtual void DoClose() = 0;
 
     /**
-     * @brief Writes interleaved PCM samples to the platform audio device.
+     * @brief Hands interleaved PCM samples to the backend.
      *
-     * Receives audio already in the correct output format (stereo or 6-channel).
+     * Receives audio already in the correct output format (stereo or 6-channel). The
+     * default implementation queues it into the ring for the device callback; push-style
+     * backends override this to queue and then feed the device.
      *
      * @param buf Sample data.
      * @param len Length of @p buf in bytes.
      */
-    virtual void DoPlay(const uint8_t* buf, size_t len) = 0;
+    virtual void DoPlay(const uint8_t* buf, size_t len);
+
+    /**
+     * @brief Producer side: appends whole frames from @p buf to the ring.
+     *
+     * Frames that do not fit are dropped and counted in GetDroppedFrameCount().
+     *
+     * @return Number of frames queued.
+     */
+    size_t QueueFrames(const uint8_t* buf, size_t len);
+
+    /**
+     * @brief Consumer side for callback-driven devices: fills exactly @p frames frames.
+     *
+     * Outputs silence until the ring has been primed to the desired depth, then reads
+     * from it. A short read is padded with silence, counted as an underrun, and
+     * re-arms priming so the device waits for a full buffer instead of stuttering.
+     *
+     * @param out Destination for @p frames interleaved frames.
+     * @param frames Number of frames the device asked for.
+     * @return Number of frames that came from the ring (the rest is silence).
+     */
+    size_t RenderFrames(uint8_t* out, size_t frames);
+
+    /**
+     * @brief Consumer side for push-style devices: copies up to @p maxFrames queued frames.
+     *
+     * Unlike RenderFrames() this never pads; the caller reports device starvation
+     * itself via ReportUnderrun().
+     *
+     * @return Number of frames copied into @p out.
+     */
+    size_t DrainFrames(uint8_t* out, size_t maxFrames);
+
+    /** @brief Records an underrun detected by the device rather than by RenderFrames(). */
+    void ReportUnderrun();
+
+    /** @brief Returns the number of frames currently waiting in the ring. */
+    int32_t GetQueuedFrames() const;
+
+    /** @brief Returns the size of one output frame in bytes for the current channel setting. */
+    size_t GetBytesPerFrame() const;
+
+    /**
+     * @brief Records the device's period (frames per callback) so the latency floor follows the hardware.
+     * @param frames Period reported by the platform API.
+     */
+    void SetDevicePeriod(int32_t frames);
 
   private:
+    /** @brief Reallocates the ring for the current channel count and clears per-stream playback state. */
+    void ResetRing();
+
+    /** @brief Producer side: moves the desired buffered depth based on underruns and drops since last call. */
+    void AdaptLatency();
+
+    /** @brief Clamps @p frames to the adaptive range and publishes it as the new target. */
+    void SetTargetBuffered(int32_t frames);
+
     std::unique_ptr<SoundMatrixDecoder>
         mSoundMatrixDecoder; ///< Stereo-to-surround decoder (active in matrix-5.1 mode).
 
     AudioSettings mAudioSettings;
     bool mInitialized = false;
+
+    AudioRingBuffer mRing; ///< Frames queued by Play() and pulled by the device callback.
+    bool mPrimed = false;  ///< Consumer-only: true once the ring reached the target after start or an underrun.
+
+    std::atomic<int32_t> mTargetBuffered{ 0 };     ///< Current desired buffered depth in frames.
+    std::atomic<int32_t> mDevicePeriod{ 0 };       ///< Largest device period seen, in frames.
+    std::atomic<uint64_t> mUnderrunCount{ 0 };     ///< Underruns since construction.
+    std::atomic<uint64_t> mDroppedFrameCount{ 0 }; ///< Frames dropped on a full ring since construction.
+    std::atomic<uint64_t> mConsumedFrames{ 0 };    ///< Device clock: frames rendered or drained.
+
+    // Producer-only adaptation state.
+    uint64_t mSeenUnderruns = 0;
+    uint64_t mSeenDroppedFrames = 0;
+    uint64_t mWindowStart = 0;
+    int32_t mCleanWindows = 0;
 };
 } // namespace Ship
 
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Ship {
+
+/**
+ * @brief Lock-free single-producer / single-consumer ring of interleaved PCM frames.
+ *
+ * One thread (the game's audio thread) calls Write(); one other thread (the backend's
+ * device callback) calls Read(). Neither side ever blocks or allocates. The read and
+ * write cursors are free-running frame counters; the capacity is rounded up to a power
+ * of two so wrapping is a mask.
+ *
+ * Reset() is not thread safe and must only be called while neither side is running.
+ */
+class AudioRingBuffer {
+  public:
+    AudioRingBuffer() = default;
+    AudioRingBuffer(const AudioRingBuffer&) = delete;
+    AudioRingBuffer& operator=(const AudioRingBuffer&) = delete;
+
+    /**
+     * @brief Reallocates the ring and clears both cursors.
+     * @param capacityFrames Minimum number of frames the ring must hold (rounded up to a power of two).
+     * @param bytesPerFrame Size of one interleaved frame in bytes (channels * sizeof(sample)).
+     */
+    void Reset(size_t capacityFrames, size_t bytesPerFrame);
+
+    /**
+     * @brief Producer side: copies up to @p frames frames into the ring.
+     * @return Number of frames written; frames that did not fit are not written.
+     */
+    size_t Write(const uint8_t* buf, size_t frames);
+
+    /**
+     * @brief Consumer side: copies up to @p frames frames out of the ring.
+     * @return Number of frames read; the rest of @p out is left untouched.
+     */
+    size_t Read(uint8_t* out, size_t frames);
+
+    /** @brief Returns the number of frames currently queued. Safe to call from either side. */
+    size_t Size() const;
+
+    /** @brief Returns the total number of frames the ring can hold. */
+    size_t Capacity() const;
+
+    /** @brief Returns the size of one frame in bytes. */
+    size_t GetBytesPerFrame() const;
+
+  private:
+    void CopyIn(size_t pos, const uint8_t* buf, size_t frames);
+    void CopyOut(size_t pos, uint8_t* out, size_t frames) const;
+
+    std::vector<uint8_t> mData;
+    size_t mCapacity = 0;
+    size_t mMask = 0;
+    size_t mBytesPerFrame = 0;
+
+    // Cursors live on separate cache lines so the producer and consumer do not false-share.
+    alignas(64) std::atomic<size_t> mWritePos{ 0 };
+    alignas(64) std::atomic<size_t> mReadPos{ 0 };
+};
+} // namespace Ship
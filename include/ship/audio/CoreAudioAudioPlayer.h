@@ -4,16 +4,15 @@
 
 #include "AudioPlayer.h"
 #include <AudioToolbox/AudioToolbox.h>
-#include <pthread.h>
 
 namespace Ship {
 /**
  * @brief AudioPlayer implementation backed by Apple's Core Audio framework.
  *
- * CoreAudioAudioPlayer uses an AudioUnit (kAudioUnitSubType_DefaultOutput) with a
- * render callback to pull interleaved PCM samples from an internal ring buffer.
- * DoPlay() pushes data into the ring buffer, and the Core Audio render callback
- * reads from it on the audio thread.
+ * CoreAudioAudioPlayer uses an AudioUnit (kAudioUnitSubType_HALOutput) with a
+ * render callback to pull interleaved PCM samples from the AudioPlayer's lock-free
+ * ring. Play() pushes data into the ring, and the Core Audio render callback
+ * reads from it on the real-time audio thread without taking any lock.
  *
  * This backend is only available on Apple platforms (macOS / iOS).
  */
@@ -26,11 +25,6 @@ class CoreAudioAudioPlayer : public AudioPlayer {
     CoreAudioAudioPlayer(AudioSettings settings);
     ~CoreAudioAudioPlayer();
 
-    /**
-     * @brief Returns the number of audio frames currently queued in the ring buffer.
-     */
-    int Buffered() override;
-
   protected:
     /**
      * @brief Opens and configures the Core Audio output unit.
@@ -39,23 +33,16 @@ class CoreAudioAudioPlayer : public AudioPlayer {
     bool DoInit() override;
 
     /**
-     * @brief Stops and disposes of the Core Audio output unit and frees the ring buffer.
+     * @brief Stops and disposes of the Core Audio output unit.
      */
     void DoClose() override;
 
-    /**
-     * @brief Copies interleaved PCM samples into the ring buffer for playback.
-     * @param buf Interleaved sample data.
-     * @param len Length of @p buf in bytes.
-     */
-    void DoPlay(const uint8_t* buf, size_t len) override;
-
   private:
     /**
      * @brief Core Audio render callback that pulls samples from the ring buffer.
      *
      * Called on the audio thread by the output AudioUnit whenever it needs more
-     * sample data. Reads from the ring buffer under the mutex lock.
+     * sample data. Reads from the shared ring via RenderFrames().
      *
      * @param inRefCon Pointer to the owning CoreAudioAudioPlayer instance.
      * @param ioActionFlags Render action flags (unused).
@@ -71,11 +58,6 @@ class CoreAudioAudioPlayer : public AudioPlayer {
 
     AudioUnit mAudioUnit;
     int32_t mNumChannels;
-    uint8_t* mRingBuffer;       ///< Lock-protected circular buffer for audio samples.
-    size_t mRingBufferSize;     ///< Total size of the ring buffer in bytes.
-    size_t mRingBufferReadPos;  ///< Current read position in the ring buffer.
-    size_t mRingBufferWritePos; ///< Current write position in the ring buffer.
-    pthread_mutex_t mMutex;     ///< Guards concurrent access to the ring buffer.
     bool mInitialized;
 };
 } // namespace Ship
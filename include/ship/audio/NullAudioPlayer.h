@@ -1,13 +1,19 @@
 #pragma once
 #include "AudioPlayer.h"
+#include <chrono>
+#include <vector>
 
 namespace Ship {
 /**
  * @brief A no-op AudioPlayer used when no audio device is available or audio is disabled.
  *
- * NullAudioPlayer silently discards all audio data. DoInit() succeeds immediately,
- * Buffered() always returns the desired buffered frame count so the game continues to
- * produce audio at the expected rate, and DoPlay() is a no-op.
+ * NullAudioPlayer stands in for a device by draining the shared ring at the configured
+ * sample rate against the wall clock and discarding the samples, so Buffered() hovers
+ * around the desired depth and the game keeps producing audio at the expected rate.
+ *
+ * With an external clock enabled the wall clock is ignored and the ring is only drained
+ * by explicit Render() calls, which makes the ring and the adaptive buffering logic
+ * deterministic to drive from tests.
  *
  * This backend is always compiled in and is selected as a fallback when every other
  * backend fails to initialise.
@@ -16,17 +22,29 @@ class NullAudioPlayer final : public AudioPlayer {
   public:
     /**
      * @brief Constructs a NullAudioPlayer with the given audio settings.
-     * @param settings Audio configuration (rates are accepted but otherwise unused).
+     * @param settings Audio configuration; the sample rate paces the simulated device.
      */
     NullAudioPlayer(AudioSettings settings) : AudioPlayer(settings) {
     }
     ~NullAudioPlayer();
 
     /**
-     * @brief Returns the desired buffered frame count so the game always produces audio.
+     * @brief Returns the number of frames still queued after draining the elapsed time.
      */
     int Buffered() override;
 
+    /**
+     * @brief Switches between wall-clock draining and draining only through Render().
+     * @param external true to stop consuming audio on the wall clock.
+     */
+    void SetExternalClock(bool external);
+
+    /**
+     * @brief Simulates one device callback asking for @p frames frames.
+     * @return Number of frames that came from the ring; the remainder was silence.
+     */
+    size_t Render(size_t frames);
+
   protected:
     /** @brief Always returns true — no actual device needs to be opened. */
     bool DoInit() override;
@@ -34,7 +52,16 @@ class NullAudioPlayer final : public AudioPlayer {
     /** @brief No-op — nothing to close. */
     void DoClose() override;
 
-    /** @brief Silently discards all audio data. */
+    /** @brief Queues the data, then drains whatever the simulated device would have played. */
     void DoPlay(const uint8_t* buf, size_t len) override;
+
+  private:
+    /** @brief Renders the frames the wall clock says have elapsed since the last call. */
+    void RenderElapsed();
+
+    std::vector<uint8_t> mScratch; ///< Destination for rendered (discarded) frames.
+    std::chrono::steady_clock::time_point mLastRender;
+    double mPendingFrames = 0.0; ///< Fractional frames carried between wall-clock renders.
+    bool mExternalClock = false;
 };
 } // namespace Ship
@@ -1,12 +1,14 @@
 #pragma once
 #include "AudioPlayer.h"
+#include <vector>
 #include <SDL3/SDL.h>
 
 namespace Ship {
 /**
  * @brief AudioPlayer implementation backed by SDL3's audio subsystem.
  *
- * SDLAudioPlayer opens the platform output with `SDL_OpenAudioDeviceStream` and queues PCM in DoPlay().
+ * SDLAudioPlayer opens the platform output with `SDL_OpenAudioDeviceStream` and a stream callback that
+ * pulls exactly what the device asks for from the shared ring, so SDL's own queue stays one period deep.
  * It supports stereo and 6-channel output according to the configured AudioChannelsSetting.
  * This backend is available on all platforms that Ship supports.
  */
@@ -21,7 +23,7 @@ class SDLAudioPlayer final : public AudioPlayer {
     ~SDLAudioPlayer();
 
     /**
-     * @brief Returns the number of audio frames currently queued in the SDL audio device.
+     * @brief Returns the number of audio frames queued in the ring plus those already handed to SDL.
      *
      * Used by the audio subsystem to decide how many frames to produce per game tick.
      */
@@ -39,15 +41,19 @@ class SDLAudioPlayer final : public AudioPlayer {
      */
     void DoClose() override;
 
+  private:
     /**
-     * @brief Queues interleaved PCM samples to the SDL audio device.
-     * @param buf Interleaved sample data (stereo: L,R,… or surround: FL,FR,C,LFE,SL,SR,…).
-     * @param len Length of @p buf in bytes.
+     * @brief SDL stream callback; runs on SDL's audio thread whenever the device needs more data.
+     * @param userdata The owning SDLAudioPlayer.
+     * @param stream Stream to feed.
+     * @param additionalAmount Bytes SDL needs right now.
+     * @param totalAmount Bytes SDL would like in total (unused).
      */
-    void DoPlay(const uint8_t* buf, size_t len) override;
+    static void SDLCALL AudioStreamCallback(void* userdata, SDL_AudioStream* stream, int additionalAmount,
+                                            int totalAmount);
 
-  private:
     SDL_AudioStream* mStream = nullptr; ///< Stream bound to the opened SDL audio device.
     int32_t mNumChannels = 2;           ///< Number of output channels (2 for stereo, 6 for 5.1).
+    std::vector<uint8_t> mScratch;      ///< Callback-thread staging buffer between the ring and SDL.
 };
 } // namespace Ship
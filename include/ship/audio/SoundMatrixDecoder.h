@@ -18,16 +18,35 @@ namespace Ship {
  * - Linkwitz-Riley crossover filters for frequency band separation
  * - All-pass filters for phase manipulation
  * - Delay lines for surround channel timing
+ *
+ * Two implementations are available. The double-precision path evaluates each
+ * filter one sample at a time and is kept as the reference. The default
+ * single-precision path runs the same filter bank as structure-of-arrays
+ * biquad banks (each 4th-order Linkwitz-Riley filter split into its two
+ * Butterworth sections) four lanes at a time with SSE2/NEON, and computes the
+ * all-pass sweep coefficients a block at a time.
  */
 class SoundMatrixDecoder {
   public:
+    /**
+     * @brief Arithmetic used by Process().
+     */
+    enum class Precision {
+        Double, ///< Scalar double-precision reference implementation.
+        Float   ///< SIMD single-precision implementation.
+    };
+
     /**
      * Construct and initialize the decoder with a specific sample rate.
      * @param sampleRate The audio sample rate in Hz
+     * @param precision Which implementation Process() should use
      */
-    SoundMatrixDecoder(int32_t sampleRate);
+    SoundMatrixDecoder(int32_t sampleRate, Precision precision = Precision::Float);
     ~SoundMatrixDecoder() = default;
 
+    /** @brief Returns the implementation used by Process(). */
+    Precision GetPrecision() const;
+
     /**
      * Reset filter states without recomputing coefficients.
      * Useful when audio is interrupted to prevent clicks.
@@ -43,6 +62,11 @@ class SoundMatrixDecoder {
     std::tuple<const uint8_t*, int> Process(const uint8_t* buf, size_t len);
 
   private:
+    /** @brief Number of lanes in a SIMD filter bank. */
+    static constexpr int gLanes = 4;
+    /** @brief Samples processed per all-pass coefficient block in the float path. */
+    static constexpr int gBlockSize = 256;
+
     /**
      * @brief State for a 4th-order IIR (Linkwitz-Riley) biquad cascade filter.
      *
@@ -82,6 +106,61 @@ class SoundMatrixDecoder {
         bool Ready = false;
     };
 
+    /**
+     * @brief A single 2nd-order section used for two-section cascades on one channel.
+     *
+     * Transposed direct form II with a0 normalized to 1. The state holds both
+     * sections of the cascade.
+     */
+    struct BiquadSection {
+        float B0 = 0;
+        float B1 = 0;
+        float B2 = 0;
+        float A1 = 0;
+        float A2 = 0;
+        float S1[2] = {};
+        float S2[2] = {};
+    };
+
+    /**
+     * @brief Coefficients for four independent 2nd-order sections (one per lane).
+     *
+     * Transposed direct form II with a0 normalized to 1, stored as
+     * structure-of-arrays so each coefficient loads as one SIMD register.
+     */
+    struct BiquadBankCoefficients {
+        alignas(16) float B0[gLanes] = {};
+        alignas(16) float B1[gLanes] = {};
+        alignas(16) float B2[gLanes] = {};
+        alignas(16) float A1[gLanes] = {};
+        alignas(16) float A2[gLanes] = {};
+    };
+
+    /**
+     * @brief Per-lane state for a bank of two cascaded 2nd-order sections.
+     *
+     * Two Butterworth sections in cascade form one 4th-order Linkwitz-Riley filter.
+     */
+    struct BiquadBankState {
+        alignas(16) float S1[2][gLanes] = {};
+        alignas(16) float S2[2][gLanes] = {};
+    };
+
+    /**
+     * @brief Per-lane state for the four sweeping all-pass chains in the float path.
+     *
+     * The sweep itself stays in double precision since it compounds over
+     * millions of samples; only the filter arithmetic runs in float.
+     */
+    struct AllPassBank {
+        alignas(16) float XHist[4][gLanes] = {};
+        alignas(16) float YHist[4][gLanes] = {};
+        double Freq[gLanes] = {};
+        double FreqMin[gLanes] = {};
+        double FreqMax[gLanes] = {};
+        double SweepRate[gLanes] = {};
+    };
+
     /**
      * @brief Fixed-length circular delay buffer for surround channel timing.
      */
@@ -108,6 +187,46 @@ class SoundMatrixDecoder {
      */
     FilterCoefficients DesignHighPass(double frequency, int32_t sampleRate);
 
+    /**
+     * @brief Designs one 2nd-order Butterworth section of a Linkwitz-Riley crossover.
+     *
+     * Two of these in cascade are equivalent to DesignLowPass() / DesignHighPass().
+     *
+     * @param frequency Cutoff frequency in Hz.
+     * @param sampleRate Audio sample rate in Hz.
+     * @param highPass True for a high-pass section, false for low-pass.
+     * @return Section coefficients with cleared state.
+     */
+    static BiquadSection DesignSection(double frequency, int32_t sampleRate, bool highPass);
+
+    /**
+     * @brief Copies a section's coefficients into one lane of a bank.
+     * @param coef Bank to write into.
+     * @param lane Lane index within the bank.
+     * @param section Section whose coefficients to copy.
+     */
+    static void SetLane(BiquadBankCoefficients& coef, int lane, const BiquadSection& section);
+
+    /**
+     * @brief Decodes using the scalar double-precision reference path.
+     * @param stereoInput Interleaved stereo samples.
+     * @param samplePairs Number of stereo sample pairs.
+     */
+    void ProcessDouble(const int16_t* stereoInput, int samplePairs);
+
+    /**
+     * @brief Decodes using the SIMD single-precision path.
+     * @param stereoInput Interleaved stereo samples.
+     * @param samplePairs Number of stereo sample pairs.
+     */
+    void ProcessFloat(const int16_t* stereoInput, int samplePairs);
+
+    /**
+     * @brief Advances the all-pass sweeps and fills mAllPassCoef for the next block.
+     * @param count Number of samples in the block (at most gBlockSize).
+     */
+    void PrepareAllPassBlock(int count);
+
     /**
      * @brief Runs a single sample through a 4th-order IIR biquad cascade.
      * @param sample Input sample value.
@@ -148,6 +267,7 @@ class SoundMatrixDecoder {
      */
     static int16_t Saturate(float value);
 
+    Precision mPrecision = Precision::Float;
     int32_t mDelayLength = 0;
     double mAllPassBaseRate = 1.0; // Precomputed for ProcessAllPass
 
@@ -176,6 +296,17 @@ class SoundMatrixDecoder {
     CircularDelay mDelaySurrLeft;
     CircularDelay mDelaySurrRight;
 
+    // Float path: surround HP lanes are {L main, L cross, R main, R cross};
+    // front lanes are {center HP, LFE LP, unused, unused}.
+    BiquadBankCoefficients mCoefSurroundBank;
+    BiquadBankCoefficients mCoefFrontBank;
+    BiquadBankState mSurroundBank;
+    BiquadBankState mFrontBank;
+    // Center low-pass consumes the center high-pass output of the same sample, so it runs scalar
+    BiquadSection mCenterLowPassSection;
+    AllPassBank mPhaseBank;
+    alignas(16) float mAllPassCoef[gBlockSize][gLanes] = {};
+
     // Output buffer
     std::vector<int16_t> mSurroundBuffer;
 };
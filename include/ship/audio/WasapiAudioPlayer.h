@@ -18,6 +18,10 @@ namespace Ship {
  * IMMNotificationClient so it can detect when the default audio device changes at
  * runtime and seamlessly switch to the new device without requiring a restart.
  *
+ * WASAPI is driven in push mode: Play() queues into the shared ring and DoPlay() then
+ * moves as much as the render buffer has room for, so frames that do not fit wait in
+ * the ring instead of being truncated.
+ *
  * This backend is only compiled on Windows (`#ifdef _WIN32`).
  */
 class WasapiAudioPlayer : public AudioPlayer, public IMMNotificationClient {
@@ -30,7 +34,7 @@ class WasapiAudioPlayer : public AudioPlayer, public IMMNotificationClient {
     }
 
     /**
-     * @brief Returns the number of frames currently queued in the WASAPI render buffer.
+     * @brief Returns the number of frames queued in the ring plus those in the WASAPI render buffer.
      *
      * Used by the audio subsystem to pace audio production.
      */
@@ -49,12 +53,20 @@ class WasapiAudioPlayer : public AudioPlayer, public IMMNotificationClient {
     void DoClose() override;
 
     /**
-     * @brief Writes interleaved PCM samples to the WASAPI render buffer.
+     * @brief Queues interleaved PCM samples and feeds the WASAPI render buffer from the ring.
      * @param buf Sample data (stereo or surround, depending on channel setting).
      * @param len Length of @p buf in bytes.
      */
     void DoPlay(const uint8_t* buf, size_t len) override;
 
+    /**
+     * @brief Moves queued frames from the ring into free space in the render buffer.
+     *
+     * Starts the client once the desired depth is reached and reports an underrun if the
+     * device had drained completely since the last call. Caller must hold mMutex.
+     */
+    void FeedDevice();
+
     // IMMNotificationClient overrides — used to detect audio device changes.
 
     /** @brief Called when the state of an audio endpoint device changes. */
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ControlPort.h"
+#include "InputSnapshot.h"
 #include <vector>
 #include "ship/config/Config.h"
 #include "ship/config/ConsoleVariable.h"
@@ -94,6 +95,20 @@ class ControlDeck : public Component {
     bool KeyboardGameInputBlocked();
     /** @brief Returns true if any blocker has blocked mouse game input. */
     bool MouseGameInputBlocked();
+    /**
+     * @brief Captures the blocked flags and every connected gamepad's buttons, axes and gyro.
+     *
+     * WriteToPad() implementations call this once per frame, after pumping SDL events and
+     * before reading any controller, so every mapping in the frame sees the same state.
+     */
+    void UpdateInputSnapshot();
+    /**
+     * @brief Returns the current frame's input snapshot.
+     *
+     * If UpdateInputSnapshot() has not run since the last ImGui frame began, the snapshot is
+     * refreshed first, so callers outside WriteToPad() (e.g. the input editor) never see stale state.
+     */
+    const InputSnapshot& GetInputSnapshot();
     /**
      * @brief Forwards a keyboard event to all controllers that have keyboard bindings.
      * @param eventType Key-down or key-up.
@@ -148,6 +163,8 @@ class ControlDeck : public Component {
     std::shared_ptr<Window> mWindow;
     std::shared_ptr<ConsoleVariable> mConsoleVariables;
     std::shared_ptr<WheelHandler> mWheelHandler;
+    InputSnapshot mInputSnapshot;
+    int32_t mInputSnapshotFrame = -1;
 
     /** @brief Returns the cached Window component. */
     std::shared_ptr<Window> GetWindow() const;
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <SDL3/SDL.h>
+
+namespace Ship {
+
+/**
+ * @brief Gamepad state for one controller port, folded over every SDL gamepad the port is not ignoring.
+ *
+ * Button and axis-direction state are stored as bitmasks so compiled button tables can test
+ * them with a single AND. Raw axis extremes are kept for analog mappings.
+ */
+struct PortInputSnapshot {
+    /** @brief Bit @c b is set if SDL_GamepadButton @c b is held on any of the port's gamepads. */
+    uint64_t Buttons = 0;
+    /**
+     * @brief Bit @c (axis * 2 + 1) / @c (axis * 2) is set if the axis is past its button threshold
+     * in the positive / negative direction on any of the port's gamepads.
+     */
+    uint64_t AxisDirections = 0;
+    /** @brief Largest value seen for each SDL_GamepadAxis across the port's gamepads (0 if none). */
+    int16_t AxisMax[SDL_GAMEPAD_AXIS_COUNT] = {};
+    /** @brief Smallest value seen for each SDL_GamepadAxis across the port's gamepads (0 if none). */
+    int16_t AxisMin[SDL_GAMEPAD_AXIS_COUNT] = {};
+    /** @brief True if Gyro holds a sample from the first gyro-equipped gamepad on the port. */
+    bool HasGyro = false;
+    /** @brief Raw gyro sample (pitch, yaw, roll). Only sampled for ports with an SDL gyro mapping. */
+    float Gyro[3] = {};
+    /** @brief Number of SDL gamepads contributing to this port. */
+    uint8_t GamepadCount = 0;
+
+    /** @brief Returns the AxisDirections bit for the given SDL axis and direction (1 = positive). */
+    static constexpr uint64_t AxisDirectionBit(int32_t axis, bool positive) {
+        return 1ULL << (axis * 2 + (positive ? 1 : 0));
+    }
+};
+
+/**
+ * @brief Everything controller mappings read during one frame of input processing.
+ *
+ * Built once per frame by ControlDeck::UpdateInputSnapshot() so that mappings never query SDL,
+ * ImGui or the console variables themselves.
+ */
+struct InputSnapshot {
+    bool GamepadBlocked = false;
+    bool KeyboardBlocked = false;
+    bool MouseBlocked = false;
+    /** @brief One entry per controller port, indexed by port. */
+    std::vector<PortInputSnapshot> Ports;
+
+    /** @brief Returns the port's state, or an empty state for ports outside the deck. */
+    const PortInputSnapshot& GetPort(uint8_t portIndex) const {
+        static const PortInputSnapshot sEmpty;
+        return portIndex < Ports.size() ? Ports[portIndex] : sEmpty;
+    }
+};
+} // namespace Ship
@@ -4,6 +4,7 @@
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include <vector>
 #include "ship/controller/controldevice/controller/mapping/keyboard/KeyboardScancodes.h"
 
 namespace Ship {
@@ -120,6 +121,10 @@ class ControllerButton {
 
     /**
      * @brief Evaluates all active mappings and sets the corresponding bits in @p padButtons.
+     *
+     * SDL gamepad mappings are evaluated from the compiled table against the control deck's
+     * input snapshot; all other mappings are asked to update the pad themselves.
+     *
      * @param padButtons Reference to the pad button bitfield to update.
      */
     void UpdatePad(CONTROLLERBUTTONS_T& padButtons);
@@ -147,11 +152,23 @@ class ControllerButton {
     bool HasMappingsForPhysicalDeviceType(PhysicalDeviceType physicalDeviceType);
 
   private:
+    /** @brief SDL sources, as PortInputSnapshot bits, that set @c Bitmask when any of them is active. */
+    struct SDLButtonRule {
+        uint64_t Buttons;
+        uint64_t AxisDirections;
+        CONTROLLERBUTTONS_T Bitmask;
+    };
+
     uint8_t mPortIndex;
     CONTROLLERBUTTONS_T mBitmask;
     std::unordered_map<std::string, std::shared_ptr<ControllerButtonMapping>> mButtonMappings;
     std::string GetConfigNameFromBitmask(CONTROLLERBUTTONS_T bitmask);
 
+    /** @brief Recompiles mSDLButtonRules and mOtherButtonMappings; called whenever mButtonMappings changes. */
+    void RebuildMappingTable();
+    std::vector<SDLButtonRule> mSDLButtonRules;
+    std::vector<ControllerButtonMapping*> mOtherButtonMappings;
+
     bool mUseEventInputToCreateNewMapping;
     KbScancode mKeyboardScancodeForNewMapping;
     MouseBtn mMouseButtonForNewMapping;
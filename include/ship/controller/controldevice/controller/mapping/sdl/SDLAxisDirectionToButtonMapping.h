@@ -31,6 +31,9 @@ class SDLAxisDirectionToButtonMapping final : public ControllerButtonMapping, pu
      */
     void UpdatePad(CONTROLLERBUTTONS_T& padButtons) override;
 
+    /** @brief Returns the PortInputSnapshot::AxisDirections bit for the bound axis direction. */
+    uint64_t GetSDLAxisDirectionMask();
+
     /** @brief Returns the mapping type identifier. */
     int8_t GetMappingType() override;
 
@@ -30,6 +30,9 @@ class SDLButtonToButtonMapping final : public SDLButtonToAnyMapping, public Cont
      */
     void UpdatePad(CONTROLLERBUTTONS_T& padButtons) override;
 
+    /** @brief Returns the PortInputSnapshot::Buttons bit for the bound gamepad button. */
+    uint64_t GetSDLButtonMask();
+
     /** @brief Returns the mapping type identifier. */
     int8_t GetMappingType() override;
 
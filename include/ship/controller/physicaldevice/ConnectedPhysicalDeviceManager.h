@@ -30,6 +30,12 @@ class ConnectedPhysicalDeviceManager {
      */
     std::unordered_map<int32_t, SDL_Gamepad*> GetConnectedSDLGamepadsForPort(uint8_t portIndex);
 
+    /**
+     * @brief Returns every connected SDL gamepad, regardless of port ignore lists.
+     * @return Map of SDL joystick instance ID to SDL_Gamepad pointer.
+     */
+    const std::unordered_map<int32_t, SDL_Gamepad*>& GetConnectedSDLGamepads() const;
+
     /**
      * @brief Returns the display names of all connected SDL gamepads.
      * @return Map of SDL joystick instance ID to human-readable gamepad name.
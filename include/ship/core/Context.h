@@ -171,7 +171,10 @@ class Context : public Component {
     /**
      * @brief Drives one frame of all registered TickableComponents for a specific EventID.
      *
-     * Runs all tickables in list order for the provided EventID only.
+     * Components that declared tick dependencies are ordered only against earlier components they conflict
+     * with; AnyThread ones are spread over the ThreadPool child (if present) while the calling thread runs the
+     * MainThread ones and helps with the rest. Components without declarations run in list order, on the
+     * calling thread, after everything before them. Returns once every component has ticked.
      */
     void Tick(EventID eventId);
 
@@ -191,7 +194,31 @@ class Context : public Component {
     std::chrono::steady_clock::time_point mInitTime{};
     double mElapsedTimeSeconds = 0.0;
 
+    /** @brief One component in the tick dependency graph. */
+    struct TickNode {
+        std::shared_ptr<TickableComponent> Tickable;
+        /** @brief Nodes that may only start once this one has ticked. */
+        std::vector<size_t> Successors;
+        /** @brief Number of nodes that must tick before this one. */
+        size_t Predecessors = 0;
+        bool OnMainThread = true;
+    };
+
+    void RebuildTickSchedule();
+
+    struct TickRun;
+    /** @brief Queues @p index to run once its predecessors have ticked. Called with the run's mutex held. */
+    void MarkTickReady(const std::shared_ptr<TickRun>& run, size_t index);
+    /** @brief Ticks @p index with @p lock released, then readies its successors or records its exception. */
+    void RunTickNode(const std::shared_ptr<TickRun>& run, std::unique_lock<std::mutex>& lock, size_t index);
+    /** @brief Worker task body: runs AnyThread nodes until none are ready. */
+    void RunWorkerTicks(const std::shared_ptr<TickRun>& run);
+
     TickableList mTickableComponents;
+    // Dependency graph over mTickableComponents, rebuilt when the list's schedule version changes.
+    std::vector<TickNode> mTickSchedule;
+    uint64_t mTickScheduleVersion = UINT64_MAX;
+    bool mTickScheduleIsParallel = false;
 #ifdef COMPONENT_THREAD_SAFE
     mutable std::mutex mTickableMutex;
 #endif
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <algorithm>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
+#include <stdint.h>
 
 #include "ship/core/ActionList.h"
 #include "ship/actions/EventAction.h"
@@ -21,6 +25,13 @@ namespace Ship {
  * `EventAction`s. This avoids scanning the full action list during
  * `Tickable::Tick(EventID)`.
  *
+ * Each per-EventID bucket is an immutable, already priority-ordered array.
+ * Adding or removing an action builds a replacement array and swaps it in, so
+ * dispatch only has to take a reference to the current array: no copy and no
+ * heap allocation happens on the `Get(EventID)` path. Arrays handed out by
+ * `Get()` stay valid (and unchanged) even if listeners are added or removed
+ * while the caller is still iterating.
+ *
  * Non-`EventAction` entries remain fully supported in the underlying
  * `ActionList`, but are omitted from the event index.
  */
@@ -31,6 +42,9 @@ class EventActionList : public ActionList {
     using ActionList::GetFirst;
     using ActionList::Has;
 
+    /** @brief Immutable, dispatch-ordered array of actions for one EventID. */
+    using Bucket = std::vector<std::shared_ptr<Action>>;
+
     /**
      * @brief Returns true if any indexed EventAction exists for @p eventId.
      * @param eventId EventID to search for.
@@ -40,17 +54,21 @@ class EventActionList : public ActionList {
 
     /**
      * @brief Returns the indexed EventActions for a single EventID.
+     *
+     * The returned array is shared with the index and never mutated after
+     * publication, so this call does not allocate.
+     *
      * @param eventId EventID to retrieve.
-     * @return Snapshot of actions in dispatch order for that EventID.
+     * @return Actions in dispatch order for that EventID (never null).
      */
-    std::shared_ptr<std::vector<std::shared_ptr<Action>>> Get(EventID eventId) const;
+    std::shared_ptr<const Bucket> Get(EventID eventId) const;
 
     /**
      * @brief Returns the indexed EventActions for a set of EventIDs.
      * @param eventIds EventIDs to retrieve.
      * @return Snapshot of matching actions, grouped by the order of unique IDs in @p eventIds.
      */
-    std::shared_ptr<std::vector<std::shared_ptr<Action>>> Get(const std::vector<EventID>& eventIds) const;
+    std::shared_ptr<const Bucket> Get(const std::vector<EventID>& eventIds) const;
 
   protected:
     /**
@@ -69,63 +87,87 @@ class EventActionList : public ActionList {
 
   private:
     static bool ShouldInsertBefore(const std::shared_ptr<Action>& existing, const std::shared_ptr<Action>& incoming);
-    void IndexEventAction(const std::shared_ptr<Action>& action);
+    static const std::shared_ptr<const Bucket>& EmptyBucket();
+
+    /**
+     * @brief Publishes a new bucket containing @p action for its EventID.
+     * @return Sorted position of @p action in the flat list, or `SIZE_MAX` if it is not an EventAction.
+     */
+    size_t IndexEventAction(const std::shared_ptr<Action>& action);
     void UnindexEventAction(const std::shared_ptr<Action>& action);
 
-    std::unordered_map<EventID, std::vector<std::shared_ptr<Action>>> mEventActions;
+    std::unordered_map<EventID, std::shared_ptr<const Bucket>> mEventActions;
+    /** @brief Number of indexed actions per EventID, ordered by EventID for flat-list positioning. */
+    std::map<EventID, size_t> mEventActionCounts;
+#ifdef COMPONENT_THREAD_SAFE
+    /** @brief Guards `mEventActions`; only held long enough to load or swap a bucket pointer. */
+    mutable std::mutex mEventActionsMutex;
+#endif
 };
 
+inline const std::shared_ptr<const EventActionList::Bucket>& EventActionList::EmptyBucket() {
+    static const std::shared_ptr<const Bucket> empty = std::make_shared<const Bucket>();
+    return empty;
+}
+
 inline bool EventActionList::Has(EventID eventId) const {
+#ifdef COMPONENT_THREAD_SAFE
+    const std::lock_guard<std::mutex> lock(mEventActionsMutex);
+#endif
     auto it = mEventActions.find(eventId);
-    return it != mEventActions.end() && !it->second.empty();
+    return it != mEventActions.end() && !it->second->empty();
 }
 
-inline std::shared_ptr<std::vector<std::shared_ptr<Action>>> EventActionList::Get(EventID eventId) const {
-    auto result = std::make_shared<std::vector<std::shared_ptr<Action>>>();
+inline std::shared_ptr<const EventActionList::Bucket> EventActionList::Get(EventID eventId) const {
+#ifdef COMPONENT_THREAD_SAFE
+    const std::lock_guard<std::mutex> lock(mEventActionsMutex);
+#endif
     auto it = mEventActions.find(eventId);
-    if (it != mEventActions.end()) {
-        result->insert(result->end(), it->second.begin(), it->second.end());
-    }
-    return result;
+    return it != mEventActions.end() ? it->second : EmptyBucket();
 }
 
-inline std::shared_ptr<std::vector<std::shared_ptr<Action>>>
+inline std::shared_ptr<const EventActionList::Bucket>
 EventActionList::Get(const std::vector<EventID>& eventIds) const {
-    auto result = std::make_shared<std::vector<std::shared_ptr<Action>>>();
-    std::unordered_set<EventID> seen;
-    for (const auto eventId : eventIds) {
-        if (!seen.insert(eventId).second) {
+    if (eventIds.size() == 1) {
+        return Get(eventIds.front());
+    }
+
+    auto result = std::make_shared<Bucket>();
+    for (size_t i = 0; i < eventIds.size(); i++) {
+        const EventID eventId = eventIds[i];
+        if (std::find(eventIds.begin(), eventIds.begin() + i, eventId) != eventIds.begin() + i) {
             continue;
         }
-        auto it = mEventActions.find(eventId);
-        if (it != mEventActions.end()) {
-            result->insert(result->end(), it->second.begin(), it->second.end());
-        }
+        const auto bucket = Get(eventId);
+        result->insert(result->end(), bucket->begin(), bucket->end());
     }
     return result;
 }
 
 inline void EventActionList::Added(std::shared_ptr<Action> action, const bool forced) {
     ActionList::Added(action, forced);
-    IndexEventAction(action);
+    const size_t position = IndexEventAction(action);
+    if (position == SIZE_MAX) {
+        return;
+    }
 
     // Keep the flat list sorted by EventID so that the generic Get() returns
-    // actions in a predictable EventID-ascending order.
-    auto& list = GetList();
-    std::stable_sort(list.begin(), list.end(), [](const std::shared_ptr<Action>& a, const std::shared_ptr<Action>& b) {
-        const auto* ea = dynamic_cast<const EventAction*>(a.get());
-        const auto* eb = dynamic_cast<const EventAction*>(b.get());
-        if (!ea && !eb) {
-            return false;
-        }
-        if (!ea) {
-            return false;
-        }
-        if (!eb) {
-            return true;
-        }
-        return ea->GetEventId() < eb->GetEventId();
-    });
+    // actions in a predictable EventID-ascending order. The new action was
+    // appended, so it only has to be rotated back to its sorted position.
+#ifdef COMPONENT_THREAD_SAFE
+    const std::lock_guard<std::recursive_mutex> lock(GetMutex());
+#endif
+    const auto& current = static_cast<const EventActionList&>(*this).GetList();
+    auto found = std::find(current.rbegin(), current.rend(), action);
+    if (found == current.rend()) {
+        return;
+    }
+
+    const size_t index = static_cast<size_t>(std::distance(found, current.rend())) - 1;
+    if (position < index) {
+        auto& list = GetList();
+        std::rotate(list.begin() + position, list.begin() + index, list.begin() + index + 1);
+    }
 }
 
 inline void EventActionList::Removed(std::shared_ptr<Action> action, const bool forced) {
@@ -148,17 +190,34 @@ inline bool EventActionList::ShouldInsertBefore(const std::shared_ptr<Action>& e
     return incomingListener->GetSequence() < existingListener->GetSequence();
 }
 
-inline void EventActionList::IndexEventAction(const std::shared_ptr<Action>& action) {
+inline size_t EventActionList::IndexEventAction(const std::shared_ptr<Action>& action) {
     auto* eventAction = dynamic_cast<EventAction*>(action.get());
     if (eventAction == nullptr) {
-        return;
+        return SIZE_MAX;
     }
 
-    auto& bucket = mEventActions[eventAction->GetEventId()];
-    auto insertIt = std::find_if(bucket.begin(), bucket.end(), [&action](const std::shared_ptr<Action>& existing) {
+#ifdef COMPONENT_THREAD_SAFE
+    const std::lock_guard<std::mutex> lock(mEventActionsMutex);
+#endif
+    auto& slot = mEventActions[eventAction->GetEventId()];
+    auto bucket = std::make_shared<Bucket>();
+    if (slot != nullptr) {
+        bucket->reserve(slot->size() + 1);
+        bucket->assign(slot->begin(), slot->end());
+    }
+    auto insertIt = std::find_if(bucket->begin(), bucket->end(), [&action](const std::shared_ptr<Action>& existing) {
         return ShouldInsertBefore(existing, action);
     });
-    bucket.insert(insertIt, action);
+    bucket->insert(insertIt, action);
+    slot = std::move(bucket);
+
+    const EventID eventId = eventAction->GetEventId();
+    mEventActionCounts[eventId]++;
+    size_t position = 0;
+    for (auto it = mEventActionCounts.begin(); it != mEventActionCounts.end() && it->first <= eventId; ++it) {
+        position += it->second;
+    }
+    return position - 1;
 }
 
 inline void EventActionList::UnindexEventAction(const std::shared_ptr<Action>& action) {
@@ -167,20 +226,36 @@ inline void EventActionList::UnindexEventAction(const std::shared_ptr<Action>& a
         return;
     }
 
+#ifdef COMPONENT_THREAD_SAFE
+    const std::lock_guard<std::mutex> lock(mEventActionsMutex);
+#endif
     auto it = mEventActions.find(eventAction->GetEventId());
     if (it == mEventActions.end()) {
         return;
     }
 
-    auto& bucket = it->second;
-    bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
-                                [&action](const std::shared_ptr<Action>& existing) {
-                                    return existing && action && existing->GetId() == action->GetId();
-                                }),
-                 bucket.end());
+    auto bucket = std::make_shared<Bucket>();
+    bucket->reserve(it->second->size());
+    std::copy_if(it->second->begin(), it->second->end(), std::back_inserter(*bucket),
+                 [&action](const std::shared_ptr<Action>& existing) {
+                     return !(existing && action && existing->GetId() == action->GetId());
+                 });
+
+    const size_t removed = it->second->size() - bucket->size();
+    if (removed > 0) {
+        auto countIt = mEventActionCounts.find(it->first);
+        if (countIt != mEventActionCounts.end()) {
+            countIt->second -= std::min(countIt->second, removed);
+            if (countIt->second == 0) {
+                mEventActionCounts.erase(countIt);
+            }
+        }
+    }
 
-    if (bucket.empty()) {
+    if (bucket->empty()) {
         mEventActions.erase(it);
+    } else {
+        it->second = std::move(bucket);
     }
 }
 
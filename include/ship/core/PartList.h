@@ -4,6 +4,9 @@
 #include <vector>
 #include <memory>
 #include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <algorithm>
 #include <mutex>
 #include <stdint.h>
@@ -108,6 +111,20 @@ template <typename C> struct PartListStoredPtrTraits<C, std::weak_ptr<C>> {
  * objects. Storage pointer type is configurable (shared_ptr or weak_ptr), while
  * the public API remains shared_ptr-based.
  *
+ * Alongside the ordered storage the list keeps two side indexes:
+ * - an ID index, so `Get(id)` / `Has(id)` are hash lookups;
+ * - a type index keyed by `std::type_index`, holding every Part that matches a
+ *   queried type (including base types) in list order.
+ *
+ * A type is registered in the type index the first time it is queried through
+ * `Has<T>()`, `Get<T>()`, `GetFirst<T>()` or `Remove<T>()`; from then on each
+ * newly added Part is tested against every registered type once, at insertion.
+ * Typed lookups therefore never `dynamic_cast` on the hot path.
+ *
+ * Because typed lookups are const but may register a type, the type index has
+ * its own mutex that is taken even without COMPONENT_THREAD_SAFE, so concurrent
+ * readers stay safe as they were with a plain scan of the list.
+ *
  * @tparam C         The element type; must be derived from Part.
  * @tparam StoredPtr The stored pointer type (shared_ptr<C> or weak_ptr<C>).
  */
@@ -259,7 +276,11 @@ template <typename C = Part, typename StoredPtr = std::shared_ptr<C>> class Part
     /**
      * @brief Direct access to the underlying vector for strong-storage lists.
      *
-     * Available only when `StoredPtr` is `std::shared_ptr<C>`.
+     * Available only when `StoredPtr` is `std::shared_ptr<C>`. Intended for
+     * reordering the existing Parts (e.g. sorting); Parts must still be added
+     * and removed through `Add()` / `Remove()` so the ID index stays correct.
+     * Calling this marks the type index for a lazy rebuild on the next typed
+     * lookup, since its buckets mirror list order.
      */
     template <typename P = StoredPtr>
     typename std::enable_if<std::is_same<P, std::shared_ptr<C>>::value, std::vector<P>&>::type GetList();
@@ -318,14 +339,38 @@ template <typename C = Part, typename StoredPtr = std::shared_ptr<C>> class Part
   private:
     using PtrTraits = PartListStoredPtrTraits<C, StoredPtr>;
 
+    /** @brief A Part matching an indexed type, with its pointer already adjusted to that type. */
+    struct TypedPart {
+        uint64_t Id;
+        StoredPtr Ptr;
+        void* Typed;
+    };
+
+    /** @brief All Parts matching one queried type, in list order. */
+    struct TypeBucket {
+        void* (*Cast)(C* part) = nullptr;
+        std::vector<TypedPart> Parts;
+    };
+
+    template <typename T> static void* CastTo(C* part);
+
     std::shared_ptr<C> LockPtr(const StoredPtr& ptr) const;
     StoredPtr StorePtr(const std::shared_ptr<C>& ptr) const;
     bool IsExpiredPtr(const StoredPtr& ptr) const;
     void PruneExpired();
     bool ContainsIdUnlocked(const uint64_t id) const;
     bool EraseByIdUnlocked(const uint64_t id, std::shared_ptr<C>* removedPart = nullptr);
+    void AppendUnlocked(const std::shared_ptr<C>& part);
+    void IndexTypedPart(TypeBucket& bucket, const StoredPtr& item) const;
+    // Takes mTypeIndexMutex itself. The returned bucket stays valid while the list is not modified.
+    template <typename T> TypeBucket& GetTypeBucketUnlocked() const;
+    template <typename T> std::shared_ptr<T> LockTyped(const TypedPart& entry) const;
 
     std::vector<StoredPtr> mList;
+    std::unordered_map<uint64_t, StoredPtr> mIdIndex;
+    mutable std::unordered_map<std::type_index, TypeBucket> mTypeIndex;
+    mutable bool mTypeIndexDirty = false;
+    mutable std::mutex mTypeIndexMutex;
     uint64_t mMutationVersion = 0;
 #ifdef COMPONENT_THREAD_SAFE
     mutable std::recursive_mutex mMutex;
@@ -359,24 +404,41 @@ template <typename C, typename StoredPtr> bool PartList<C, StoredPtr>::IsExpired
     return PtrTraits::IsExpired(ptr);
 }
 
+template <typename C, typename StoredPtr>
+template <typename T>
+void* PartList<C, StoredPtr>::CastTo(C* part) {
+    return dynamic_cast<T*>(part);
+}
+
 template <typename C, typename StoredPtr> void PartList<C, StoredPtr>::PruneExpired() {
+    // Strong storage never holds null entries (Add() rejects them), so there is nothing to prune.
+    if constexpr (std::is_same<StoredPtr, std::shared_ptr<C>>::value) {
+        return;
+    }
+
     const auto oldSize = mList.size();
     mList.erase(std::remove_if(mList.begin(), mList.end(), [this](const StoredPtr& ptr) { return IsExpiredPtr(ptr); }),
                 mList.end());
     if (mList.size() != oldSize) {
+        std::erase_if(mIdIndex, [this](const auto& entry) { return IsExpiredPtr(entry.second); });
+        const std::lock_guard<std::mutex> typeLock(mTypeIndexMutex);
+        mTypeIndexDirty = true;
         ++mMutationVersion;
     }
 }
 
 template <typename C, typename StoredPtr> bool PartList<C, StoredPtr>::ContainsIdUnlocked(const uint64_t id) const {
-    return std::find_if(mList.begin(), mList.end(), [this, id](const StoredPtr& item) {
-               auto locked = LockPtr(item);
-               return locked && locked->GetId() == id;
-           }) != mList.end();
+    auto it = mIdIndex.find(id);
+    return it != mIdIndex.end() && !IsExpiredPtr(it->second);
 }
 
 template <typename C, typename StoredPtr>
 bool PartList<C, StoredPtr>::EraseByIdUnlocked(const uint64_t id, std::shared_ptr<C>* removedPart) {
+    auto indexIt = mIdIndex.find(id);
+    if (indexIt == mIdIndex.end()) {
+        return false;
+    }
+
     auto it = std::find_if(mList.begin(), mList.end(), [this, id](const StoredPtr& item) {
         auto locked = LockPtr(item);
         return locked && locked->GetId() == id;
@@ -391,10 +453,79 @@ bool PartList<C, StoredPtr>::EraseByIdUnlocked(const uint64_t id, std::shared_pt
     }
 
     mList.erase(it);
+    mIdIndex.erase(indexIt);
+    const std::lock_guard<std::mutex> typeLock(mTypeIndexMutex);
+    if (!mTypeIndexDirty) {
+        for (auto& [type, bucket] : mTypeIndex) {
+            std::erase_if(bucket.Parts, [id](const TypedPart& entry) { return entry.Id == id; });
+        }
+    }
     ++mMutationVersion;
     return true;
 }
 
+template <typename C, typename StoredPtr> void PartList<C, StoredPtr>::AppendUnlocked(const std::shared_ptr<C>& part) {
+    auto stored = StorePtr(part);
+    mList.push_back(stored);
+    mIdIndex[part->GetId()] = stored;
+    const std::lock_guard<std::mutex> typeLock(mTypeIndexMutex);
+    if (!mTypeIndexDirty) {
+        for (auto& [type, bucket] : mTypeIndex) {
+            IndexTypedPart(bucket, stored);
+        }
+    }
+    ++mMutationVersion;
+}
+
+template <typename C, typename StoredPtr>
+void PartList<C, StoredPtr>::IndexTypedPart(TypeBucket& bucket, const StoredPtr& item) const {
+    auto locked = LockPtr(item);
+    if (!locked) {
+        return;
+    }
+
+    void* typed = bucket.Cast(locked.get());
+    if (typed != nullptr) {
+        bucket.Parts.push_back(TypedPart{ locked->GetId(), item, typed });
+    }
+}
+
+template <typename C, typename StoredPtr>
+template <typename T>
+typename PartList<C, StoredPtr>::TypeBucket& PartList<C, StoredPtr>::GetTypeBucketUnlocked() const {
+    // Registering a type inserts into the map, which never moves existing buckets, and a dirty rebuild only
+    // follows a modification of the list, so buckets handed to other readers are not touched here.
+    const std::lock_guard<std::mutex> typeLock(mTypeIndexMutex);
+    if (mTypeIndexDirty) {
+        for (auto& [type, bucket] : mTypeIndex) {
+            bucket.Parts.clear();
+            for (const auto& item : mList) {
+                IndexTypedPart(bucket, item);
+            }
+        }
+        mTypeIndexDirty = false;
+    }
+
+    auto [it, inserted] = mTypeIndex.try_emplace(std::type_index(typeid(T)));
+    if (inserted) {
+        it->second.Cast = &PartList<C, StoredPtr>::CastTo<T>;
+        for (const auto& item : mList) {
+            IndexTypedPart(it->second, item);
+        }
+    }
+    return it->second;
+}
+
+template <typename C, typename StoredPtr>
+template <typename T>
+std::shared_ptr<T> PartList<C, StoredPtr>::LockTyped(const TypedPart& entry) const {
+    auto locked = LockPtr(entry.Ptr);
+    if (!locked) {
+        return nullptr;
+    }
+    return std::shared_ptr<T>(std::move(locked), static_cast<T*>(entry.Typed));
+}
+
 template <typename C, typename StoredPtr>
 ListReturnCode PartList<C, StoredPtr>::Add(std::shared_ptr<C> part, const bool force) {
     if (!part) {
@@ -417,8 +548,7 @@ ListReturnCode PartList<C, StoredPtr>::Add(std::shared_ptr<C> part, const bool f
         if (ContainsIdUnlocked(id)) {
             return ListReturnCode::Duplicate;
         }
-        mList.push_back(StorePtr(part));
-        ++mMutationVersion;
+        AppendUnlocked(part);
     }
 
     bool shouldRunHooks = false;
@@ -517,8 +647,7 @@ ListReturnCode PartList<C, StoredPtr>::Remove(std::shared_ptr<C> part, const boo
 #endif
         PruneExpired();
         if (!ContainsIdUnlocked(id)) {
-            mList.push_back(StorePtr(removedPart));
-            ++mMutationVersion;
+            AppendUnlocked(removedPart);
         }
         return ListReturnCode::Failed;
     }
@@ -534,14 +663,11 @@ ListReturnCode PartList<C, StoredPtr>::Remove(const uint64_t id, const bool forc
         const std::lock_guard<std::recursive_mutex> lock(mMutex);
 #endif
         PruneExpired();
-        if (!ContainsIdUnlocked(id)) {
+        auto found = mIdIndex.find(id);
+        if (found == mIdIndex.end()) {
             return ListReturnCode::NotFound;
         }
-        auto found = std::find_if(mList.begin(), mList.end(), [this, id](const StoredPtr& item) {
-            auto locked = LockPtr(item);
-            return locked && locked->GetId() == id;
-        });
-        candidate = found != mList.end() ? LockPtr(*found) : nullptr;
+        candidate = LockPtr(found->second);
     }
 
     if (!candidate) {
@@ -591,8 +717,7 @@ ListReturnCode PartList<C, StoredPtr>::Remove(const uint64_t id, const bool forc
 #endif
         PruneExpired();
         if (!ContainsIdUnlocked(id)) {
-            mList.push_back(StorePtr(removedPart));
-            ++mMutationVersion;
+            AppendUnlocked(removedPart);
         }
         return ListReturnCode::Failed;
     }
@@ -662,10 +787,11 @@ ListReturnCode PartList<C, StoredPtr>::Remove(const bool force) {
 #endif
         PruneExpired();
 
-        snapshot.reserve(mList.size());
-        for (const auto& item : mList) {
-            auto locked = LockPtr(item);
-            if (locked && std::dynamic_pointer_cast<T>(locked) != nullptr) {
+        const auto& bucket = GetTypeBucketUnlocked<T>();
+        snapshot.reserve(bucket.Parts.size());
+        for (const auto& entry : bucket.Parts) {
+            auto locked = LockPtr(entry.Ptr);
+            if (locked) {
                 snapshot.push_back(locked);
             }
         }
@@ -731,6 +857,8 @@ template <typename C, typename StoredPtr>
 template <typename P>
 typename std::enable_if<std::is_same<P, std::shared_ptr<C>>::value, std::vector<P>&>::type
 PartList<C, StoredPtr>::GetList() {
+    const std::lock_guard<std::mutex> typeLock(mTypeIndexMutex);
+    mTypeIndexDirty = true;
     return mList;
 }
 
@@ -779,10 +907,9 @@ template <typename C, typename StoredPtr> template <typename T> bool PartList<C,
     const std::lock_guard<std::recursive_mutex> lock(mMutex);
 #endif
     const_cast<PartList<C, StoredPtr>*>(this)->PruneExpired();
-    return std::find_if(mList.begin(), mList.end(), [this](const StoredPtr& item) {
-               auto locked = LockPtr(item);
-               return locked && std::dynamic_pointer_cast<T>(locked) != nullptr;
-           }) != mList.end();
+    const auto& bucket = GetTypeBucketUnlocked<T>();
+    return std::find_if(bucket.Parts.begin(), bucket.Parts.end(),
+                        [this](const TypedPart& entry) { return !IsExpiredPtr(entry.Ptr); }) != bucket.Parts.end();
 }
 
 template <typename C, typename StoredPtr> bool PartList<C, StoredPtr>::Has(const uint64_t id) const {
@@ -814,11 +941,8 @@ template <typename C, typename StoredPtr> std::shared_ptr<C> PartList<C, StoredP
     const std::lock_guard<std::recursive_mutex> lock(mMutex);
 #endif
     const_cast<PartList<C, StoredPtr>*>(this)->PruneExpired();
-    auto it = std::find_if(mList.begin(), mList.end(), [this, id](const StoredPtr& item) {
-        auto locked = LockPtr(item);
-        return locked && locked->GetId() == id;
-    });
-    return it != mList.end() ? LockPtr(*it) : nullptr;
+    auto it = mIdIndex.find(id);
+    return it != mIdIndex.end() ? LockPtr(it->second) : nullptr;
 }
 
 template <typename C, typename StoredPtr>
@@ -845,15 +969,13 @@ std::shared_ptr<std::vector<std::shared_ptr<T>>> PartList<C, StoredPtr>::Get() c
     const std::lock_guard<std::recursive_mutex> lock(mMutex);
 #endif
     const_cast<PartList<C, StoredPtr>*>(this)->PruneExpired();
+    const auto& bucket = GetTypeBucketUnlocked<T>();
     auto result = std::make_shared<std::vector<std::shared_ptr<T>>>();
-    for (const auto& item : mList) {
-        auto locked = LockPtr(item);
-        if (!locked) {
-            continue;
-        }
-        auto typed = std::dynamic_pointer_cast<T>(locked);
+    result->reserve(bucket.Parts.size());
+    for (const auto& entry : bucket.Parts) {
+        auto typed = LockTyped<T>(entry);
         if (typed) {
-            result->push_back(typed);
+            result->push_back(std::move(typed));
         }
     }
     return result;
@@ -866,12 +988,8 @@ std::shared_ptr<T> PartList<C, StoredPtr>::GetFirst() const {
     const std::lock_guard<std::recursive_mutex> lock(mMutex);
 #endif
     const_cast<PartList<C, StoredPtr>*>(this)->PruneExpired();
-    for (const auto& item : mList) {
-        auto locked = LockPtr(item);
-        if (!locked) {
-            continue;
-        }
-        auto typed = std::dynamic_pointer_cast<T>(locked);
+    for (const auto& entry : GetTypeBucketUnlocked<T>().Parts) {
+        auto typed = LockTyped<T>(entry);
         if (typed) {
             return typed;
         }
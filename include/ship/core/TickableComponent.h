@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "ship/core/Tickable.h"
@@ -19,6 +20,14 @@ enum class TickGroup : uint32_t { TickGroupDefault = 0 };
 /** @brief Controls execution order within a TickGroup (lower runs first). */
 enum class TickPriority : uint32_t { TickPriorityDefault = 0 };
 
+/**
+ * @brief Thread a TickableComponent with declared tick dependencies may be ticked on.
+ *
+ * MainThread components always run on the thread calling Context::Tick(), which is also the thread that
+ * renders. AnyThread components may run on a ThreadPool worker.
+ */
+enum class TickAffinity : uint32_t { MainThread = 0, AnyThread };
+
 /**
  * @brief Combines Tickable and Component, auto-registering with a Context.
  *
@@ -107,6 +116,38 @@ class TickableComponent : public Tickable, public Component, public std::enable_
      */
     TickableComponent& SetTickPriority(const TickPriority tickPriority);
 
+    /**
+     * @brief Declares the shared state this component reads and writes while ticking.
+     *
+     * Resources are free-form names agreed on between components (e.g. "Audio", "ControlDeck"). Once declared,
+     * Context::Tick() only orders this component after earlier components whose declarations conflict with it
+     * and may tick it concurrently with the rest. Components that never declare anything keep running in list
+     * order, on the calling thread, after everything before them.
+     * @param reads Resources this component only reads.
+     * @param writes Resources this component modifies.
+     * @return A reference to this for chaining.
+     */
+    TickableComponent& SetTickDependencies(std::vector<std::string> reads, std::vector<std::string> writes);
+
+    /** @brief Returns true if SetTickDependencies() has been called. */
+    bool HasTickDependencies() const;
+
+    /** @brief Returns the resources declared as read. */
+    const std::vector<std::string>& GetTickReads() const;
+
+    /** @brief Returns the resources declared as written. */
+    const std::vector<std::string>& GetTickWrites() const;
+
+    /**
+     * @brief Sets which thread this component may be ticked on. Only applies with declared tick dependencies.
+     * @param tickAffinity The new TickAffinity.
+     * @return A reference to this for chaining.
+     */
+    TickableComponent& SetTickAffinity(const TickAffinity tickAffinity);
+
+    /** @brief Returns the thread this component may be ticked on. */
+    TickAffinity GetTickAffinity() const;
+
     /**
      * @brief Changes the Context this component is associated with.
      * @param context The new Context.
@@ -126,6 +167,10 @@ class TickableComponent : public Tickable, public Component, public std::enable_
   private:
     TickGroup mTickGroup;
     TickPriority mTickPriority;
+    TickAffinity mTickAffinity = TickAffinity::MainThread;
+    bool mHasTickDependencies = false;
+    std::vector<std::string> mTickReads;
+    std::vector<std::string> mTickWrites;
     std::vector<EventID> mPendingEventIds;
     std::vector<std::shared_ptr<Action>> mPendingActions;
 };
@@ -25,12 +25,27 @@ class TickableList : public PartList<TickableComponent, std::shared_ptr<Tickable
      */
     TickableList& Sort();
 
+    /**
+     * @brief Returns a counter that changes whenever the tick order or a member's tick dependencies may have
+     *        changed, so schedules derived from the list know when to rebuild.
+     */
+    uint64_t GetScheduleVersion() const;
+
+    /** @brief Marks schedules derived from the list as stale. */
+    void InvalidateSchedule();
+
   protected:
     /**
      * @brief Re-sorts the list after a component is added so that TickGroup /
      *        TickPriority ordering is honored during iteration.
      */
     void Added(std::shared_ptr<TickableComponent> part, const bool forced) override;
+
+    /** @brief Marks derived schedules as stale after a component is removed. */
+    void Removed(std::shared_ptr<TickableComponent> part, const bool forced) override;
+
+  private:
+    uint64_t mScheduleVersion = 0;
 };
 
 inline TickableList& TickableList::Sort() {
@@ -42,11 +57,24 @@ inline TickableList& TickableList::Sort() {
                      [](const std::shared_ptr<TickableComponent>& a, const std::shared_ptr<TickableComponent>& b) {
                          return a->GetOrder() < b->GetOrder();
                      });
+    InvalidateSchedule();
     return *this;
 }
 
+inline uint64_t TickableList::GetScheduleVersion() const {
+    return mScheduleVersion;
+}
+
+inline void TickableList::InvalidateSchedule() {
+    ++mScheduleVersion;
+}
+
 inline void TickableList::Added(std::shared_ptr<TickableComponent> /*part*/, const bool /*forced*/) {
     Sort();
 }
 
+inline void TickableList::Removed(std::shared_ptr<TickableComponent> /*part*/, const bool /*forced*/) {
+    InvalidateSchedule();
+}
+
 } // namespace Ship
@@ -3,8 +3,10 @@
 #include <vector>
 #include <cstdint>
 #include <cstddef>
+#include <functional>
 #include <unordered_map>
 #include <string>
+#include <string_view>
 
 #include "ship/core/TickableComponent.h"
 #include "ship/events/EventTypes.h"
@@ -12,6 +14,20 @@
 
 namespace Ship {
 
+/**
+ * @brief Transparent hash for caller-diagnostic keys.
+ *
+ * Lets `EventRegistration::Callers` be probed with the raw `const char*` key
+ * passed to `CallEvent()` without constructing a `std::string` per dispatch.
+ */
+struct EventCallerKeyHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view key) const noexcept {
+        return std::hash<std::string_view>{}(key);
+    }
+};
+
 /**
  * @brief Tracks registration state for a single EventID.
  *
@@ -27,7 +43,7 @@ struct EventRegistration {
     /** @brief Registration-order sequence used to preserve stable listener ordering. */
     uint64_t NextListenerSequence = 0;
     /** @brief Diagnostic map of event call sites keyed by file:line string. */
-    std::unordered_map<std::string, EventMetadata> Callers;
+    std::unordered_map<std::string, EventMetadata, EventCallerKeyHash, std::equal_to<>> Callers;
     /** @brief Active listeners for this event keyed by ListenerID. */
     std::unordered_map<ListenerID, std::shared_ptr<ListenerAction>> Listeners;
 };
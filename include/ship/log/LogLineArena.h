@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include <spdlog/common.h>
+
+namespace Ship {
+
+/**
+ * @brief Bounded, allocation-free history of formatted log lines.
+ *
+ * Line text is formatted straight into a byte ring and every line is NUL-terminated in place, so it can be
+ * handed to ImGui without a copy. Lines are addressed by a free-running sequence number. When either the
+ * line limit or the text storage is exhausted, the oldest lines are evicted to make room.
+ *
+ * Storage is allocated on the first append and reused after Clear(). Not thread safe.
+ */
+class LogLineArena {
+  public:
+    /**
+     * @param maxLines     Maximum number of lines retained.
+     * @param textCapacity Size of the text ring in bytes, including each line's terminator.
+     */
+    LogLineArena(size_t maxLines, size_t textCapacity);
+
+    /**
+     * @brief Formats a printf-style message into the arena.
+     * @return The new line's sequence number, or NextSeq() unchanged if formatting failed.
+     */
+    uint64_t AppendV(spdlog::level::level_enum priority, const char* fmt, va_list args);
+
+    /** @brief Appends an already formatted line. Lines longer than the text ring are truncated. */
+    uint64_t Append(spdlog::level::level_enum priority, std::string_view text);
+
+    /** @brief Drops every line. Sequence numbers restart from zero. */
+    void Clear();
+
+    /** @brief Sequence number of the oldest retained line. */
+    uint64_t FirstSeq() const;
+    /** @brief Sequence number the next appended line receives. */
+    uint64_t NextSeq() const;
+    bool Contains(uint64_t seq) const;
+
+    /** @brief Returns the NUL-terminated text of a retained line. */
+    const char* GetText(uint64_t seq) const;
+    std::string_view GetTextView(uint64_t seq) const;
+    spdlog::level::level_enum GetPriority(uint64_t seq) const;
+
+  private:
+    struct LineRecord {
+        uint64_t Start = 0; ///< Absolute byte position of the text in the ring.
+        uint32_t Length = 0;
+        spdlog::level::level_enum Priority = spdlog::level::info;
+    };
+
+    const LineRecord& Record(uint64_t seq) const;
+    // Returns the absolute byte position of a contiguous region of the given size, evicting old lines as needed.
+    uint64_t Reserve(size_t size);
+    uint64_t Commit(uint64_t start, size_t length, spdlog::level::level_enum priority);
+    void EvictOldest();
+    size_t UsedBytes() const;
+
+    size_t mMaxLines;
+    size_t mTextCapacity;
+    std::vector<LineRecord> mLines;
+    std::vector<char> mText;
+    uint64_t mFirstSeq = 0;
+    uint64_t mNextSeq = 0;
+    uint64_t mHead = 0; ///< Absolute byte position the next line is written at.
+};
+} // namespace Ship
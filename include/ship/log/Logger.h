@@ -41,6 +41,14 @@ class Logger : public Component {
      */
     std::shared_ptr<spdlog::logger> Get() const;
 
+    /**
+     * @brief Returns how many queued log messages have been dropped because the async queue was full.
+     *
+     * Release builds log asynchronously and drop the oldest queued message rather than block the caller.
+     * Debug builds log synchronously and never drop messages.
+     */
+    size_t GetDroppedMessageCount() const;
+
   protected:
     void OnInit(const nlohmann::json& initArgs) override;
 
@@ -6,8 +6,10 @@
 #include <list>
 #include <vector>
 #include <mutex>
+#include <atomic>
 #include <queue>
 #include <variant>
+#include <functional>
 #include "ship/resource/ResourceIdentifier.h"
 #include "ship/resource/Resource.h"
 #include "ship/resource/ResourceLoader.h"
@@ -45,6 +47,26 @@ struct ResourceFilter {
     const std::shared_ptr<Archive> Parent = nullptr;
 };
 
+/**
+ * @brief Snapshot of the resource cache's memory accounting, as returned by ResourceManager::GetCacheStats().
+ */
+struct ResourceCacheStats {
+    /** @brief Number of loaded resources currently cached. */
+    size_t Resources = 0;
+    /** @brief Sum of IResource::GetPointerSize() over the cached resources. */
+    size_t Bytes = 0;
+    /** @brief Configured byte budget; 0 means unlimited. */
+    size_t Budget = 0;
+    /** @brief Number of resources evicted to stay within the budget since startup. */
+    uint64_t Evictions = 0;
+    /** @brief Total bytes released by those evictions. */
+    uint64_t EvictedBytes = 0;
+    /** @brief Resources read from an archive because a caller needed them and they were not cached yet. */
+    uint64_t DemandLoads = 0;
+    /** @brief Resources read from an archive ahead of time by access-manifest prefetching. */
+    uint64_t PrefetchLoads = 0;
+};
+
 /**
  * @brief Central manager for loading, caching, and unloading game resources.
  *
@@ -52,6 +74,15 @@ struct ResourceFilter {
  * an in-memory cache of loaded IResource objects, dispatches asynchronous load requests
  * to a thread pool, and delegates actual deserialization to ResourceLoader.
  *
+ * The cache can optionally be given a byte budget. Cached resources are kept in access
+ * order, and EvictToBudget() drops the least recently used ones that nothing outside the
+ * cache still references. The renderer calls it once per frame after presenting, so
+ * resources it holds raw pointers to stay pinned for the whole frame.
+ *
+ * Loads can also be prefetched from an access manifest. While recording, the first access
+ * to each resource after EnterScene() is logged against the announced scene key; on later
+ * runs, announcing the same key queues those resources on the thread pool at low priority.
+ *
  * **Required dependencies (constructor-injected):**
  * - **ThreadPool** — used for all asynchronous resource load/unload operations.
  * - **Keystore** — optional; passed through to ArchiveManager/Archive for signature validation.
@@ -59,6 +90,7 @@ struct ResourceFilter {
  * Obtain the instance from `Context::GetChildren().GetFirst<ResourceManager>()`.
  */
 class ResourceManager : public Component {
+    friend class Archive;
     friend class ResourceLoader;
     typedef enum class ResourceLoadError { None, NotCached, NotFound } ResourceLoadError;
 
@@ -272,6 +304,18 @@ class ResourceManager : public Component {
      */
     void DirtyResources(const ResourceFilter& filter);
 
+    /**
+     * @brief Synchronously drops the cached copies of the given files.
+     *
+     * Called by the ArchiveManager when the archive that wins these hashes changes.
+     * Loaded resources are marked dirty; cached load failures are forgotten so the
+     * next request looks the file up again. Resources loaded from a specific parent
+     * archive are left alone.
+     *
+     * @param fileHashes CRC64 hashes of the affected virtual paths.
+     */
+    void DirtyResources(const std::vector<uint64_t>& fileHashes);
+
     /**
      * @brief Synchronously unloads all resources matching a glob mask.
      * @param searchMask Glob pattern.
@@ -398,6 +442,59 @@ class ResourceManager : public Component {
      */
     void* GetResourceRawPointer(uint64_t crc);
 
+    /**
+     * @brief Sets the memory budget for cached resources.
+     * @param bytes Budget in bytes as measured by IResource::GetPointerSize(); 0 disables eviction.
+     */
+    void SetCacheBudget(size_t bytes);
+
+    /** @brief Returns the memory budget for cached resources in bytes (0 = unlimited). */
+    size_t GetCacheBudget();
+
+    /** @brief Returns the current cache size and eviction counters. */
+    ResourceCacheStats GetCacheStats();
+
+    /**
+     * @brief Evicts least recently used, unreferenced resources until the cache fits its budget.
+     *
+     * Resources still referenced outside the cache are never evicted. Must not be called
+     * while raw pointers obtained from cached resources are still in use.
+     *
+     * @param onEvicted Optional callback invoked for each evicted resource before it is released,
+     *                  outside the cache lock.
+     * @return Number of resources evicted.
+     */
+    size_t EvictToBudget(const std::function<void(IResource& resource)>& onEvicted = nullptr);
+
+    /**
+     * @brief Announces that the game has entered a scene (area, level, menu, ...).
+     *
+     * Queues low-priority prefetches for every resource the access manifest lists under
+     * @p sceneKey. While recording, the scene's list is then re-recorded from scratch in
+     * first-access order.
+     *
+     * @param sceneKey Game-defined key identifying the scene.
+     */
+    void EnterScene(const std::string& sceneKey);
+
+    /** @brief Enables or disables logging of first accesses per scene into the access manifest. */
+    void SetAccessRecording(bool isEnabled);
+
+    /** @brief Returns true if first accesses are being logged into the access manifest. */
+    bool IsAccessRecording();
+
+    /**
+     * @brief Replaces the access manifest with the one stored at @p path.
+     * @return true if the file existed and was parsed.
+     */
+    bool LoadAccessManifest(const std::string& path);
+
+    /**
+     * @brief Writes the access manifest, including anything recorded this run, to @p path.
+     * @return true on success.
+     */
+    bool SaveAccessManifest(const std::string& path);
+
   protected:
     /**
      * @brief Component initialization hook. Mounts archives and starts the thread pool.
@@ -405,6 +502,7 @@ class ResourceManager : public Component {
      * Expected initArgs keys:
      * - "archivePaths" (array of strings): paths to OTR/O2R archive files or directories.
      * - "validHashes"  (array of uint32): acceptable game-version hashes; empty = all accepted.
+     * - "cacheBudget"  (uint, optional): byte budget for cached resources; 0 (default) = unlimited.
      */
     void OnInit(const nlohmann::json& initArgs = nlohmann::json::object()) override;
 
@@ -418,9 +516,39 @@ class ResourceManager : public Component {
     std::shared_ptr<IResource> GetCachedResource(std::variant<ResourceLoadError, std::shared_ptr<IResource>> cacheLine);
 
   private:
-    std::unordered_map<ResourceIdentifier, std::variant<ResourceLoadError, std::shared_ptr<IResource>>,
-                       ResourceIdentifierHash>
-        mResourceCache;
+    typedef std::variant<ResourceLoadError, std::shared_ptr<IResource>> CacheValue;
+
+    struct CacheLine {
+        CacheValue Value;
+        // Position in mResourceLru; only meaningful while Value holds a resource.
+        std::list<ResourceIdentifier>::iterator LruPosition;
+        size_t Bytes = 0;
+    };
+
+    /** @brief Replaces the cache line for @p identifier and returns the previous value. Requires mMutex. */
+    CacheValue StoreCacheLine(const ResourceIdentifier& identifier, CacheValue value);
+    /** @brief Removes a cache line and returns its value. Requires mMutex. */
+    CacheValue EraseCacheLine(std::unordered_map<ResourceIdentifier, CacheLine, ResourceIdentifierHash>::iterator it);
+
+    std::unordered_map<ResourceIdentifier, CacheLine, ResourceIdentifierHash> mResourceCache;
+    // Identifiers of cached resources, least recently used first.
+    std::list<ResourceIdentifier> mResourceLru;
+    size_t mCachedBytes = 0;
+    size_t mCacheBudget = 0;
+    uint64_t mEvictionCount = 0;
+    uint64_t mEvictedBytes = 0;
+    std::atomic<uint64_t> mDemandLoads = 0;
+    std::atomic<uint64_t> mPrefetchLoads = 0;
+
+    /** @brief Logs a caller's access to @p identifier against the current scene when recording. */
+    void RecordAccess(const ResourceIdentifier& identifier);
+
+    // Scene key -> resource paths or path hashes, as the caller asked for them, in first-access order.
+    std::unordered_map<std::string, std::vector<std::variant<std::string, uint64_t>>> mAccessManifest;
+    std::unordered_set<std::variant<std::string, uint64_t>> mRecordedInScene;
+    std::string mCurrentScene;
+    std::atomic<bool> mIsAccessRecording = false;
+    std::mutex mAccessManifestMutex;
     std::shared_ptr<ResourceLoader> mResourceLoader;
     std::shared_ptr<ArchiveManager> mArchiveManager;
     std::mutex mMutex;
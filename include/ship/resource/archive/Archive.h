@@ -4,6 +4,8 @@
 #include <string>
 #include <unordered_map>
 #include <mutex>
+#include <functional>
+#include <vector>
 #include "ship/utils/binarytools/BinaryReader.h"
 
 namespace tinyxml2 {
@@ -46,6 +48,8 @@ struct ArchiveManifest {
     std::string Checksum;  ///< Hex-encoded SHA-256 checksum of the archive contents.
     std::string Signature; ///< Base64-encoded digital signature over the checksum.
     std::string PublicKey; ///< Base64-encoded public key used to verify the signature.
+
+    uint32_t SignatureVersion; ///< Checksum layout: 1 = single sequential digest, 2 = per-file tree digest.
 };
 
 /**
@@ -101,6 +105,36 @@ class Archive : public std::enable_shared_from_this<Archive> {
      */
     virtual std::shared_ptr<File> LoadFile(uint64_t hash) = 0;
 
+    /**
+     * @brief Feeds a file's contents to @p consumer in chunks instead of materializing it.
+     *
+     * The default implementation loads the whole file and hands it over in one call;
+     * archives that can read incrementally override it. Only called from several
+     * threads at once when SupportsConcurrentStreaming() returns true.
+     *
+     * @param filePath Virtual path within the archive.
+     * @param consumer Called with each chunk in order; returning false stops the read.
+     * @return true if the whole file was read and accepted by @p consumer.
+     */
+    virtual bool StreamFile(const std::string& filePath,
+                            const std::function<bool(const uint8_t* data, size_t size)>& consumer);
+
+    /**
+     * @brief Returns true if StreamFile() may run on several threads at once for different files.
+     *
+     * Defaults to false, so checksum validation streams the files one at a time. Archives
+     * whose reads share no unsynchronized state override it to let the thread pool help.
+     */
+    virtual bool SupportsConcurrentStreaming() const;
+
+    /**
+     * @brief Computes the archive's content checksum in the given signature layout.
+     * @param signatureVersion 1 for the sequential digest, 2 for the per-file tree digest.
+     * @param checksum Receives the 64-byte BLAKE2b digest.
+     * @return false if the version is unsupported or a file could not be read.
+     */
+    bool ComputeChecksum(uint32_t signatureVersion, std::vector<uint8_t>& checksum);
+
     /**
      * @brief Returns a map of all files indexed in this archive (hash → path).
      * @return Shared pointer to the complete hash→path map.
@@ -4,6 +4,8 @@
 #include <memory>
 #include <vector>
 #include <list>
+#include <span>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <stdint.h>
@@ -38,6 +40,10 @@ using UntrustedArchiveHandler = std::function<bool(Archive& archive, KeystoreEnt
  * recently (highest index) takes precedence, allowing "mod" archives to override
  * base-game assets.
  *
+ * Every hash keeps a stack of the archives that provide it, so adding or removing a
+ * single archive only touches the hashes that archive provides. Whenever the winning
+ * archive for a hash changes, the ResourceManager is told to drop its cached copy.
+ *
  * File lookups, directory listings, and game-version validation are all delegated
  * here from the ResourceManager layer.
  *
@@ -92,6 +98,10 @@ class ArchiveManager : public Component {
 
     /**
      * @brief Removes a specific archive from the managed collection.
+     *
+     * Files the archive overrode fall back to the next archive that provides them; no
+     * other archive is re-opened or re-indexed.
+     *
      * @param archive Archive to remove.
      * @return Number of archives removed (0 or 1).
      */
@@ -148,8 +158,22 @@ class ArchiveManager : public Component {
      */
     std::shared_ptr<Archive> GetArchiveFromFile(const std::string& filePath);
 
+    /**
+     * @brief Returns every indexed virtual path that starts with @p prefix, in sorted order.
+     *
+     * The span views the manager's path index directly and is only valid until the next
+     * archive is added or removed or a file is written.
+     *
+     * @param prefix Literal path prefix, e.g. "textures/area_12/" (empty = every path).
+     */
+    std::span<const std::string_view> ListFilesWithPrefix(std::string_view prefix) const;
+
     /**
      * @brief Lists virtual paths of all files matching the given search mask across all archives.
+     *
+     * Only the paths sharing the mask's literal prefix (everything before the first
+     * wildcard) are visited, and only the part of the mask after it is glob-matched.
+     *
      * @param searchMask Glob pattern (empty = list everything).
      * @return Sorted, deduplicated list of matching paths.
      */
@@ -222,13 +246,35 @@ class ArchiveManager : public Component {
     /** @brief Rebuilds the hash-to-path and path-to-archive lookup tables from the current archive list. */
     void ResetVirtualFileSystem();
 
+    /** @brief Tells the ResourceManager that the winning archive changed for each of @p hashes. */
+    void NotifyFilesChanged(const std::vector<uint64_t>& hashes);
+
+    /** @brief Adds or removes one file's reference to the directory that contains it. */
+    void ReferenceDirectory(const std::string& filePath, bool isAdding);
+
+    /** @brief Merges paths that were just added to mHashes into the sorted path index. */
+    void IndexPaths(std::vector<std::string_view>& paths);
+
+    /** @brief Drops paths that are about to be erased from mHashes from the sorted path index. */
+    void UnindexPaths(std::vector<std::string_view>& paths);
+
+    /** @brief Appends the paths matching @p pattern to @p matches, visiting only its literal-prefix range. */
+    void MatchFiles(const std::string& pattern, std::vector<std::string_view>& matches) const;
+
   private:
     std::vector<std::shared_ptr<Archive>> mArchives;
     std::vector<uint32_t> mGameVersions;
     std::unordered_set<uint32_t> mValidGameVersions;
     std::unordered_map<uint64_t, std::string> mHashes;
-    std::unordered_set<std::string> mDirectories;
+    // Every path in mHashes in sorted order, viewing the map's strings; its nodes never move.
+    std::vector<std::string_view> mSortedPaths;
+    // Directory path -> number of indexed files directly inside it.
+    std::unordered_map<std::string, size_t> mDirectories;
     std::unordered_map<uint64_t, std::shared_ptr<Archive>> mFileToArchive;
+    // Archives providing each hash in priority order; the back entry is the one mFileToArchive holds.
+    std::unordered_map<uint64_t, std::vector<std::shared_ptr<Archive>>> mFileOverrides;
+    // Hashes each mounted archive provides.
+    std::unordered_map<std::shared_ptr<Archive>, std::vector<uint64_t>> mArchiveFiles;
     std::shared_ptr<ResourceManager> mResourceManager;
     std::shared_ptr<Keystore> mKeystore;
 #ifdef ENABLE_SCRIPTING
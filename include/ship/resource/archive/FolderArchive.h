@@ -4,7 +4,8 @@
 
 #include <string>
 #include <stdint.h>
-#include <string>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "ship/resource/File.h"
 #include "ship/resource/Resource.h"
@@ -20,6 +21,10 @@ struct File;
  * Files inside the directory are addressed by their relative paths, just like
  * files inside an OTR or O2R archive. This makes it easy to load loose-file
  * mods or development assets without packing them first.
+ *
+ * Open() walks the tree on several threads and records the on-disk path of every
+ * file under the CRC64 of its relative path, so loads resolve their path without
+ * touching the filesystem and then read the file with a single open/read.
  */
 class FolderArchive final : virtual public Archive {
   public:
@@ -65,6 +70,18 @@ class FolderArchive final : virtual public Archive {
      */
     std::shared_ptr<File> LoadFile(uint64_t hash);
 
+    /**
+     * @brief Feeds a file's contents to @p consumer in fixed-size chunks without loading it whole.
+     * @param filePath Relative file path within the archive directory.
+     * @param consumer Called with each chunk in order; returning false stops the read.
+     * @return true if the whole file was read and accepted by @p consumer.
+     */
+    bool StreamFile(const std::string& filePath,
+                    const std::function<bool(const uint8_t* data, size_t size)>& consumer) override;
+
+    /** @brief Returns true; every read opens its own file stream. */
+    bool SupportsConcurrentStreaming() const override;
+
   protected:
     /**
      * @brief Reads a file from disk without header parsing.
@@ -81,6 +98,11 @@ class FolderArchive final : virtual public Archive {
     std::shared_ptr<File> LoadFileRaw(uint64_t hash);
 
   private:
+    /** @brief Looks up the on-disk path recorded for @p hash by Open() or WriteFile(). */
+    bool ResolveDiskPath(uint64_t hash, std::string& diskPath);
+
     std::string mArchiveBasePath;
+    std::unordered_map<uint64_t, std::string> mDiskPaths;
+    std::shared_mutex mDiskPathsMutex;
 };
 } // namespace Ship
@@ -71,6 +71,18 @@ class O2rArchive final : virtual public Archive {
      */
     std::shared_ptr<File> LoadFile(uint64_t hash);
 
+    /**
+     * @brief Feeds a file's contents to @p consumer in fixed-size chunks without loading it whole.
+     * @param filePath Virtual path of the file within the ZIP.
+     * @param consumer Called with each chunk in order; returning false stops the read.
+     * @return true if the whole file was read and accepted by @p consumer.
+     */
+    bool StreamFile(const std::string& filePath,
+                    const std::function<bool(const uint8_t* data, size_t size)>& consumer) override;
+
+    /** @brief Returns true; concurrent reads each borrow their own zip handle from the pool. */
+    bool SupportsConcurrentStreaming() const override;
+
   private:
     /** @brief Acquires a zip_t* handle from the pool, opening a new one if the pool is empty. */
     zip_t* GetZipHandle();
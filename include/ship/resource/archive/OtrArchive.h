@@ -28,7 +28,10 @@ struct File;
  * structurally an MPQ archive. This class is only compiled when the project is built
  * with MPQ support enabled (`-DINCLUDE_MPQ_SUPPORT`).
  *
- * All file I/O operations are thread-safe via the StormLib handle.
+ * A StormLib archive handle must not be used by two threads at once, so reads borrow a
+ * handle from an internal pool (opening another one when the pool is empty) and return it
+ * when done. Hashes are resolved to in-archive paths through the archive's own file index,
+ * which is built once in Open(), so concurrent loads never go through the ArchiveManager.
  *
  * @deprecated OtrArchive and the ".otr" format are deprecated in favour of the
  *   ".o2r" format backed by Ship::O2rArchive. MPQ support is **disabled by
@@ -80,8 +83,21 @@ class OtrArchive final : virtual public Archive {
      */
     std::shared_ptr<File> LoadFile(uint64_t hash);
 
+    /** @brief Returns true; concurrent reads each borrow their own MPQ handle from the pool. */
+    bool SupportsConcurrentStreaming() const override;
+
   private:
+    /** @brief Acquires a StormLib archive handle from the pool, opening a new one if the pool is empty. */
+    HANDLE GetMpqHandle();
+    /** @brief Returns a StormLib archive handle back to the pool for reuse. */
+    void ReleaseMpqHandle(HANDLE handle);
+    /** @brief Reads a whole file out of the archive using the given StormLib archive handle. */
+    std::shared_ptr<File> ReadFile(HANDLE archiveHandle, const std::string& filePath);
+
     HANDLE mHandle;
+    std::mutex mPoolMutex;
+    std::vector<HANDLE> mMpqHandlePool;
+    bool mIsOpen = false; ///< Guarded by mPoolMutex. Handles released while closed are closed, not pooled.
 };
 } // namespace Ship
 
@@ -14,6 +14,7 @@
 
 namespace Ship {
 class ResourceManager;
+class ThreadPool;
 
 /**
  * @brief Security level controlling which scripts are allowed to load and execute.
@@ -32,10 +33,17 @@ enum class SafeLevel {
  * (Tiny C Compiler), then loads the resulting shared objects at runtime so their
  * exported functions can be called by the engine via GetFunction().
  *
+ * Compiled modules are cached on disk, keyed by a BLAKE2b hash of everything that
+ * affects the output (sources, defines, build options, search paths, libraries, code
+ * version and TCC version), so unchanged mods skip compilation on later launches.
+ *
  * **Required Context children (looked up at runtime):**
  * - **ResourceManager** — queried during script loading to access the ArchiveManager
  *   for enumerating script source files. ResourceManager must be added to the Context
  *   before any ScriptLoader load methods are called.
+ *
+ * **Optional dependency (constructor-injected): ThreadPool** — when present, CompileAll()
+ * builds independent archives in parallel on it.
  */
 class ScriptLoader : public Component {
   public:
@@ -48,14 +56,17 @@ class ScriptLoader : public Component {
      * @param libraryPaths   Additional library search directories.
      * @param libraries      Libraries to link against compiled scripts.
      * @param resourceManager ResourceManager for archive lookups during compilation.
+     * @param threadPool     Optional ThreadPool used to compile archives in parallel.
      */
     ScriptLoader(const std::unordered_map<std::string, std::string>& compileDefines, const uint32_t codeVersion,
                  const std::string& buildOptions, const std::vector<std::string>& includePaths,
                  const std::vector<std::string>& libraryPaths, const std::vector<std::string>& libraries,
-                 std::shared_ptr<ResourceManager> resourceManager = nullptr)
+                 std::shared_ptr<ResourceManager> resourceManager = nullptr,
+                 std::shared_ptr<ThreadPool> threadPool = nullptr)
         : Component("ScriptLoader"), mCodeVersion(codeVersion), mBuildOptions(buildOptions),
           mIncludePaths(includePaths), mLibraryPaths(libraryPaths), mLibraries(libraries),
-          mCompileDefines(compileDefines), mResourceManager(std::move(resourceManager)) {
+          mCompileDefines(compileDefines), mResourceManager(std::move(resourceManager)),
+          mThreadPool(std::move(threadPool)) {
     }
 
     /**
@@ -66,8 +77,13 @@ class ScriptLoader : public Component {
 
     /**
      * @brief Compiles scripts from all mounted archives.
-     * @param preCallback  Optional callback invoked before each archive is compiled.
-     * @param postCallback Optional callback invoked after all archives have been compiled.
+     *
+     * Archives are validated in mount order, then built concurrently on the ThreadPool (if
+     * one was provided), then registered in mount order. Init order is still decided by
+     * GetLoadersInDependencyOrder() in LoadAll().
+     *
+     * @param preCallback  Optional callback invoked before each archive's module is registered.
+     * @param postCallback Optional callback invoked after each archive's module is registered.
      */
     void
     CompileAll(const std::optional<std::function<void(const std::shared_ptr<Archive>&)>>& preCallback = std::nullopt,
@@ -103,7 +119,20 @@ class ScriptLoader : public Component {
      */
     void SetSafeLevel(SafeLevel level);
 
+    /**
+     * @brief Sets the directory used to cache compiled modules.
+     * @param path Cache directory; created on first use. An empty path disables the cache.
+     */
+    void SetCacheDirectory(const std::string& path);
+
   private:
+    /** @brief Applies the SafeLevel and code-version checks. Returns false if the archive should be skipped. */
+    bool CanCompile(const std::shared_ptr<Archive>& archive) const;
+    /** @brief Produces a loadable module for the archive in a fresh temp file and returns its path. */
+    std::string BuildModule(const std::shared_ptr<Archive>& archive) const;
+    /** @brief Loads the module at @p path and records it under the archive's name. */
+    void RegisterModule(const std::shared_ptr<Archive>& archive, const std::string& path);
+
     uint32_t mCodeVersion;
     SafeLevel mSafeLevel = SafeLevel::WARN_UNTRUSTED_SCRIPTS;
     std::string mBuildOptions = "-g -Wl";
@@ -114,6 +143,8 @@ class ScriptLoader : public Component {
     std::unordered_map<std::string, Scripting::LibraryLoader> mLoadedScripts;
     std::vector<std::shared_ptr<Archive>> mLoadedArchives;
     std::shared_ptr<ResourceManager> mResourceManager;
+    std::shared_ptr<ThreadPool> mThreadPool;
+    std::string mCacheDirectory;
 };
 
 } // namespace Ship
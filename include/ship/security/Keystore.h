@@ -86,6 +86,16 @@ class Keystore : public Component {
      */
     bool HasKey(const std::vector<uint8_t>& keyData) const;
 
+    /**
+     * @brief Looks up a key by its id, the raw key bytes themselves.
+     *
+     * Uses an index kept alongside the name map, so it does not scan the store.
+     * @param keyData Raw key bytes to search for.
+     * @param entry   Receives the matching entry when one is found.
+     * @return true if a matching key is present.
+     */
+    bool FindKey(const std::vector<uint8_t>& keyData, KeystoreEntry& entry) const;
+
     /**
      * @brief Retrieves all keys that match the given name.
      * @param keyName Name to look up.
@@ -100,7 +110,12 @@ class Keystore : public Component {
     std::vector<KeystoreEntry> GetAllKeys() const;
 
   private:
+    void IndexKey(const std::string& keyName);
+    void UnindexKey(const std::string& keyName);
+
     std::unordered_map<std::string, KeystoreEntry> mKeys;
+    // key bytes -> name of an entry holding them
+    std::unordered_map<std::string, std::string> mKeyIds;
     std::shared_ptr<Config> mConfig;
 };
 
@@ -1,15 +1,35 @@
 #pragma once
 
+#include <bit>
+#include <cmath>
+#include <cstring>
 #include <string>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 #include "endianness.h"
 #include "Stream.h"
+#include "MemoryStream.h"
 
 class BinaryReader;
 
 namespace Ship {
 
+/**
+ * @brief Compile-time description of a packed binary record, for BinaryReader::ReadStruct().
+ *
+ * Each type in @p Fields is one arithmetic field of the record, in file order and without padding. An N64
+ * vertex, for example, is described as
+ * StructLayout<int16_t, int16_t, int16_t, uint16_t, int16_t, int16_t, uint8_t, uint8_t, uint8_t, uint8_t>.
+ */
+template <typename... Fields> struct StructLayout {
+    static_assert((std::is_arithmetic_v<Fields> && ...), "StructLayout fields must be arithmetic types");
+
+    /** @brief Size of one record in bytes. */
+    static constexpr size_t Size = (sizeof(Fields) + ... + 0);
+};
+
 /**
  * @brief Sequential binary reader with configurable byte-order support.
  *
@@ -25,7 +45,11 @@ namespace Ship {
  * reader.SetEndianness(Ship::Endianness::Big);
  * uint32_t magic = reader.ReadUInt32();
  * std::string name = reader.ReadString();
+ * std::vector<int16_t> indices = reader.ReadArray<int16_t>(magic);
  * @endcode
+ *
+ * When the stream is a MemoryStream, reads copy straight out of its buffer instead of going through the
+ * virtual Stream interface.
  */
 class BinaryReader {
   public:
@@ -131,6 +155,33 @@ class BinaryReader {
     /** @brief Reads a 64-bit IEEE 754 double, applying the configured byte order. */
     double ReadDouble();
 
+    /**
+     * @brief Reads @p count consecutive values into @p dest, applying the configured byte order.
+     *
+     * The data is copied in one block and then byte swapped in place if needed, which the compiler turns into
+     * vector shuffles. Prefer this over a loop of single reads for vertex, matrix and index arrays.
+     *
+     * @tparam T Arithmetic element type.
+     * @throws std::runtime_error if @p T is floating point and any value is NaN, as ReadFloat() does.
+     */
+    template <typename T> void ReadArray(T* dest, size_t count);
+
+    /** @brief Reads @p count consecutive values into a new vector. See ReadArray(T*, size_t). */
+    template <typename T> std::vector<T> ReadArray(size_t count);
+
+    /**
+     * @brief Reads @p count packed records described by @p Layout into @p dest.
+     *
+     * @p T must be trivially copyable and have exactly the in-memory layout of @p Layout, so the records are
+     * copied in one block and each field is then byte swapped in place if needed.
+     *
+     * @tparam Layout A StructLayout listing the record's fields.
+     */
+    template <typename Layout, typename T> void ReadStruct(T* dest, size_t count = 1);
+
+    /** @brief Reads a single packed record described by @p Layout. */
+    template <typename Layout, typename T> T ReadStruct();
+
     /**
      * @brief Reads a length-prefixed UTF-8 string.
      *
@@ -154,6 +205,100 @@ class BinaryReader {
 
   protected:
     std::shared_ptr<Stream> mStream;             ///< Underlying byte stream.
+    MemoryStream* mMemoryStream = nullptr;       ///< mStream if it is a MemoryStream, for the fast read path.
     Endianness mEndianness = Endianness::Native; ///< Active byte order for multi-byte reads.
+
+  private:
+    void ReadBytes(char* dest, size_t length);
+    template <typename T> T ReadValue();
+    template <typename T> static T SwapBytes(T value);
+    template <typename T> static void SwapBytesInPlace(char* data);
+    template <typename... Fields> static void SwapFields(char* record, StructLayout<Fields...>);
 };
+
+inline void BinaryReader::ReadBytes(char* dest, size_t length) {
+    if (mMemoryStream != nullptr) {
+        memcpy(dest, mMemoryStream->Consume(length), length);
+    } else {
+        mStream->Read(dest, length);
+    }
+}
+
+template <typename T> inline T BinaryReader::SwapBytes(T value) {
+    if constexpr (sizeof(T) == 1) {
+        return value;
+    } else if constexpr (sizeof(T) == 2) {
+        return std::bit_cast<T>(static_cast<uint16_t>(BSWAP16(std::bit_cast<uint16_t>(value))));
+    } else if constexpr (sizeof(T) == 4) {
+        return std::bit_cast<T>(static_cast<uint32_t>(BSWAP32(std::bit_cast<uint32_t>(value))));
+    } else {
+        static_assert(sizeof(T) == 8, "BinaryReader only swaps 1, 2, 4 and 8 byte values");
+        return std::bit_cast<T>(static_cast<uint64_t>(BSWAP64(std::bit_cast<uint64_t>(value))));
+    }
+}
+
+template <typename T> inline void BinaryReader::SwapBytesInPlace(char* data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    value = SwapBytes(value);
+    memcpy(data, &value, sizeof(T));
+}
+
+template <typename... Fields> inline void BinaryReader::SwapFields(char* record, StructLayout<Fields...>) {
+    size_t offset = 0;
+    ((SwapBytesInPlace<Fields>(record + offset), offset += sizeof(Fields)), ...);
+}
+
+template <typename T> inline T BinaryReader::ReadValue() {
+    T result;
+    ReadBytes(reinterpret_cast<char*>(&result), sizeof(T));
+    if (mEndianness != Endianness::Native) {
+        result = SwapBytes(result);
+    }
+    return result;
+}
+
+template <typename T> void BinaryReader::ReadArray(T* dest, size_t count) {
+    static_assert(std::is_arithmetic_v<T>, "ReadArray requires an arithmetic element type");
+
+    ReadBytes(reinterpret_cast<char*>(dest), count * sizeof(T));
+    if (sizeof(T) > 1 && mEndianness != Endianness::Native) {
+        for (size_t i = 0; i < count; i++) {
+            dest[i] = SwapBytes(dest[i]);
+        }
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+        for (size_t i = 0; i < count; i++) {
+            if (std::isnan(dest[i])) {
+                throw std::runtime_error("BinaryReader::ReadArray(): Error reading stream");
+            }
+        }
+    }
+}
+
+template <typename T> std::vector<T> BinaryReader::ReadArray(size_t count) {
+    std::vector<T> result(count);
+    ReadArray(result.data(), count);
+    return result;
+}
+
+template <typename Layout, typename T> void BinaryReader::ReadStruct(T* dest, size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "ReadStruct requires a trivially copyable type");
+    static_assert(sizeof(T) == Layout::Size, "ReadStruct type size does not match its layout");
+
+    char* bytes = reinterpret_cast<char*>(dest);
+    ReadBytes(bytes, count * sizeof(T));
+    if (mEndianness != Endianness::Native) {
+        for (size_t i = 0; i < count; i++) {
+            SwapFields(bytes + i * sizeof(T), Layout{});
+        }
+    }
+}
+
+template <typename Layout, typename T> T BinaryReader::ReadStruct() {
+    T result;
+    ReadStruct<Layout>(&result);
+    return result;
+}
 } // namespace Ship
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <stdexcept>
 #include <vector>
 #include "Stream.h"
 
@@ -73,6 +74,23 @@ class MemoryStream final : public Stream {
      */
     void Read(char* dest, size_t length) override;
 
+    /**
+     * @brief Returns a pointer to the next @p length bytes and advances the position past them.
+     *
+     * Non-virtual counterpart of Read() that lets BinaryReader copy straight out of the backing buffer.
+     * The pointer is valid until the stream is next written to.
+     *
+     * @throws std::out_of_range if fewer than @p length bytes remain.
+     */
+    const char* Consume(size_t length) {
+        if (mBaseAddress > mBuffer->size() || length > mBuffer->size() - mBaseAddress) {
+            throw std::out_of_range("MemoryStream::Consume(): Read past end of stream");
+        }
+        const char* data = mBuffer->data() + mBaseAddress;
+        mBaseAddress += length;
+        return data;
+    }
+
     /**
      * @brief Reads a single signed byte and advances the position by one.
      *
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <map>
 #include <vector>
 #include <string>
@@ -7,6 +8,7 @@
 
 #include "ship/window/gui/GuiWindow.h"
 #include "ship/debug/Console.h"
+#include "ship/log/LogLineArena.h"
 #include <imgui.h>
 #include <spdlog/spdlog.h>
 
@@ -27,6 +29,10 @@ class ConsoleVariable;
  * The window integrates with spdlog through a custom sink that routes log
  * output to the "Logs" channel automatically.
  *
+ * Each channel keeps at most gMaxLogLines lines (and gMaxLogTextBytes of text) in a
+ * LogLineArena that messages are formatted into directly; older lines are discarded as
+ * new ones arrive. Only the rows currently scrolled into view are drawn.
+ *
  * Obtain the instance from Gui::GetGuiWindow("Console").
  */
 class ConsoleWindow : public GuiWindow {
@@ -127,13 +133,35 @@ class ConsoleWindow : public GuiWindow {
     void UpdateElement() override;
 
   private:
-    /** @brief An individual log entry stored in a channel's history. */
-    struct ConsoleLine {
-        std::string Text;                                         ///< Rendered text.
-        spdlog::level::level_enum Priority = spdlog::level::info; ///< Severity (controls colour).
-        std::string Channel = "Console";                          ///< Owning channel name.
+    /**
+     * @brief A channel's bounded history plus the lines that pass the active filters.
+     *
+     * Every appended line gets a sequence number from the channel's LogLineArena. Visible
+     * holds, in order, the sequence numbers of retained lines that match FilterText and
+     * FilterLevel. It is extended on Append and trimmed on eviction, and only rebuilt when
+     * the filters change.
+     */
+    struct ConsoleChannel {
+        std::string Name;
+        LogLineArena Lines{ gMaxLogLines, gMaxLogTextBytes };
+        std::deque<uint64_t> Visible;
+        std::string FilterText;
+        spdlog::level::level_enum FilterLevel = spdlog::level::trace;
+        bool FilterValid = false;
     };
 
+    /** @brief Index of the "Console" channel, which always exists. */
+    static constexpr uint32_t gConsoleChannelId = 0;
+
+    /** @brief Returns the id of the named channel, creating the channel on first use. */
+    uint32_t GetChannelId(const std::string& channel);
+    ConsoleChannel& GetChannel(uint32_t channelId);
+    void AppendToChannel(uint32_t channelId, spdlog::level::level_enum priority, const char* fmt, va_list args);
+    void ResetChannel(ConsoleChannel& channel);
+    static bool LinePassesFilter(const LogLineArena& lines, uint64_t seq, const std::string& text,
+                                 spdlog::level::level_enum level);
+    void RefreshVisibleLines(ConsoleChannel& channel);
+
     static int CallbackStub(ImGuiInputTextCallbackData* data);
     int32_t ClearCommand(const std::vector<std::string>& args, std::string* output);
     int32_t HelpCommand(const std::vector<std::string>& args, std::string* output);
@@ -144,11 +172,11 @@ class ConsoleWindow : public GuiWindow {
     int32_t GetCommand(const std::vector<std::string>& args, std::string* output);
     static int32_t CheckVarType(const std::string& input);
 
-    int32_t mSelectedId = -1;
+    int64_t mSelectedId = -1; ///< Sequence number of the selected line in the current channel, or -1.
     int32_t mHistoryIndex = -1;
-    std::vector<int> mSelectedEntries;
+    std::vector<uint64_t> mSelectedEntries;
     std::string mFilter;
-    std::string mCurrentChannel = "Console";
+    uint32_t mCurrentChannel = gConsoleChannelId;
     bool mOpenAutocomplete = false;
     char* mInputBuffer = nullptr;
     char* mFilterBuffer = nullptr;
@@ -158,7 +186,8 @@ class ConsoleWindow : public GuiWindow {
     std::map<ImGuiKey, std::string> mBindingToggle;
     std::vector<std::string> mHistory;
     std::vector<std::string> mAutoComplete;
-    std::map<std::string, std::vector<ConsoleLine>> mLog;
+    // Channels are interned: they are looked up by name once and then addressed by index.
+    std::deque<ConsoleChannel> mChannels;
     const std::vector<std::string> mLogChannels = { "Console", "Logs" };
     const std::vector<spdlog::level::level_enum> mPriorityFilters = { spdlog::level::off,  spdlog::level::critical,
                                                                       spdlog::level::err,  spdlog::level::warn,
@@ -174,6 +203,8 @@ class ConsoleWindow : public GuiWindow {
         ImVec4(0.0f, 0.0f, 0.0f, 0.0f)      // OFF
     };
     static constexpr size_t gMaxBufferSize = 255;
+    static constexpr size_t gMaxLogLines = 10000;
+    static constexpr size_t gMaxLogTextBytes = 1024 * 1024;
 
     std::shared_ptr<Console> mConsole;
     std::shared_ptr<ConsoleVariable> mConsoleVariables;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ship/window/gui/GuiWindow.h"
+#include "ship/resource/ResourceManager.h"
 
 namespace Ship {
 /**
@@ -18,7 +19,7 @@ class StatsWindow : public GuiWindow {
     virtual ~StatsWindow();
 
   protected:
-    /** @brief Performs one-time setup (no additional initialisation required). */
+    /** @brief Looks up the ResourceManager whose cache counters are shown. */
     void OnInit(const nlohmann::json& initArgs = nlohmann::json::object()) override;
 
     /** @brief Renders the stats panel contents via ImGui. */
@@ -26,5 +27,9 @@ class StatsWindow : public GuiWindow {
 
     /** @brief Updates cached counters and timing values before each draw. */
     void UpdateElement() override;
+
+  private:
+    std::shared_ptr<ResourceManager> mResourceManager;
+    ResourceCacheStats mCacheStats;
 };
 } // namespace Ship
\ No newline at end of file
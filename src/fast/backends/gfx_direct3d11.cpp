@@ -50,6 +50,9 @@ namespace Fast {
 // function pointer (prism::IncludeFunc); lambdas with captures cannot be used there.
 static std::shared_ptr<Ship::ResourceManager> sDX11ResourceManager;
 
+// Room for many full interpreter batches, so the vertex buffer is discarded a few times per frame at most.
+static constexpr size_t kVertexBufferSize = 256 * 32 * 3 * sizeof(float) * 50;
+
 GfxRenderingAPIDX11::~GfxRenderingAPIDX11() {
 }
 
@@ -263,13 +266,15 @@ void GfxRenderingAPIDX11::Init() {
     ZeroMemory(&vertex_buffer_desc, sizeof(D3D11_BUFFER_DESC));
 
     vertex_buffer_desc.Usage = D3D11_USAGE_DYNAMIC;
-    vertex_buffer_desc.ByteWidth = 256 * 32 * 3 * sizeof(float); // Same as buf_vbo size in gfx_pc
+    vertex_buffer_desc.ByteWidth = kVertexBufferSize;
     vertex_buffer_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
     vertex_buffer_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
     vertex_buffer_desc.MiscFlags = 0;
 
     ThrowIfFailed(mDevice->CreateBuffer(&vertex_buffer_desc, nullptr, mVertexBuffer.GetAddressOf()),
                   mWindowBackend->GetWindowHandle(), "Failed to create vertex buffer.");
+    // The first batch maps with discard, as no-overwrite maps are only valid after one.
+    mVertexBufferOffset = kVertexBufferSize;
 
     // Create per-frame constant buffer
 
@@ -565,23 +570,45 @@ static D3D11_TEXTURE_ADDRESS_MODE gfx_cm_to_d3d11(uint32_t val) {
     return (val & G_TX_MIRROR) ? D3D11_TEXTURE_ADDRESS_MIRROR : D3D11_TEXTURE_ADDRESS_WRAP;
 }
 
-void GfxRenderingAPIDX11::UploadTexture(const uint8_t* rgba32_buf, uint32_t width, uint32_t height) {
-    if (width == 0 || height == 0) {
-        return;
-    }
+// Spare textures kept per size; enough to cover a few textures swapping between two sizes.
+static constexpr size_t kMaxSpareTexturesPerSize = 4;
 
-    // Create texture
+void GfxRenderingAPIDX11::ReplaceTextureStorage(TextureData& textureData, uint32_t width, uint32_t height) {
+    if (textureData.texture != nullptr) {
+        // A parked view may later back a different id, so it must not satisfy the bound-view check in DrawTriangles.
+        for (auto& lastView : mLastResourceViews) {
+            if (lastView.Get() == textureData.resource_view.Get()) {
+                lastView.Reset();
+            }
+        }
 
-    TextureData* texture_data = &mTextures[mCurrentTextureIds[mCurrentTile]];
-    texture_data->width = width;
-    texture_data->height = height;
+        std::vector<TextureData>& spares = mSpareTextures[textureData.width << 16 | textureData.height];
+        if (spares.size() < kMaxSpareTexturesPerSize) {
+            TextureData& spare = spares.emplace_back();
+            spare.texture = std::move(textureData.texture);
+            spare.resource_view = std::move(textureData.resource_view);
+        }
+        textureData.texture.Reset();
+        textureData.resource_view.Reset();
+    }
+    textureData.width = width;
+    textureData.height = height;
+
+    auto spares = mSpareTextures.find(width << 16 | height);
+    if (spares != mSpareTextures.end() && !spares->second.empty()) {
+        textureData.texture = std::move(spares->second.back().texture);
+        textureData.resource_view = std::move(spares->second.back().resource_view);
+        spares->second.pop_back();
+        return;
+    }
 
     D3D11_TEXTURE2D_DESC texture_desc;
     ZeroMemory(&texture_desc, sizeof(D3D11_TEXTURE2D_DESC));
 
     texture_desc.Width = width;
     texture_desc.Height = height;
-    texture_desc.Usage = D3D11_USAGE_IMMUTABLE;
+    // Default rather than immutable usage so re-imports can overwrite the texels with UpdateSubresource.
+    texture_desc.Usage = D3D11_USAGE_DEFAULT;
     texture_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
     texture_desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
     texture_desc.CPUAccessFlags = 0;
@@ -591,18 +618,27 @@ void GfxRenderingAPIDX11::UploadTexture(const uint8_t* rgba32_buf, uint32_t widt
     texture_desc.SampleDesc.Count = 1;
     texture_desc.SampleDesc.Quality = 0;
 
-    D3D11_SUBRESOURCE_DATA resource_data;
-    resource_data.pSysMem = rgba32_buf;
-    resource_data.SysMemPitch = width * 4;
-    resource_data.SysMemSlicePitch = resource_data.SysMemPitch * height;
-
-    ThrowIfFailed(
-        mDevice->CreateTexture2D(&texture_desc, &resource_data, texture_data->texture.ReleaseAndGetAddressOf()));
+    ThrowIfFailed(mDevice->CreateTexture2D(&texture_desc, nullptr, textureData.texture.ReleaseAndGetAddressOf()));
 
     // Create shader resource view from texture
 
-    ThrowIfFailed(mDevice->CreateShaderResourceView(texture_data->texture.Get(), nullptr,
-                                                    texture_data->resource_view.ReleaseAndGetAddressOf()));
+    ThrowIfFailed(mDevice->CreateShaderResourceView(textureData.texture.Get(), nullptr,
+                                                    textureData.resource_view.ReleaseAndGetAddressOf()));
+}
+
+void GfxRenderingAPIDX11::UploadTexture(const uint8_t* rgba32_buf, uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0) {
+        return;
+    }
+
+    // Re-imports of a texture (animated or evicted and reloaded) keep their size, so in the common case this
+    // only updates texels in place and never recreates the texture or its view.
+    TextureData* texture_data = &mTextures[mCurrentTextureIds[mCurrentTile]];
+    if (texture_data->texture == nullptr || texture_data->width != width || texture_data->height != height) {
+        ReplaceTextureStorage(*texture_data, width, height);
+    }
+
+    mContext->UpdateSubresource(texture_data->texture.Get(), 0, nullptr, rgba32_buf, width * 4, 0);
 }
 
 void GfxRenderingAPIDX11::SetSamplerParameters(int tile, bool linear_filter, uint32_t cms, uint32_t cmt) {
@@ -785,14 +821,24 @@ void GfxRenderingAPIDX11::DrawTriangles(float buf_vbo[], size_t buf_vbo_len, siz
 
     // Set vertex buffer data
 
+    // Batches are appended behind each other and the buffer is only discarded once it is full, so most flushes
+    // map without the driver renaming the buffer. Each batch starts on a whole vertex of the current layout.
+    uint32_t stride = mShaderProgram->numFloats * sizeof(float);
+    uint32_t offset = 0;
+    const size_t size = buf_vbo_len * sizeof(float);
+    size_t batch_offset = (mVertexBufferOffset + stride - 1) / stride * stride;
+    D3D11_MAP map_type = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (batch_offset + size > kVertexBufferSize) {
+        batch_offset = 0;
+        map_type = D3D11_MAP_WRITE_DISCARD;
+    }
+
     D3D11_MAPPED_SUBRESOURCE ms;
     ZeroMemory(&ms, sizeof(D3D11_MAPPED_SUBRESOURCE));
-    mContext->Map(mVertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &ms);
-    memcpy(ms.pData, buf_vbo, buf_vbo_len * sizeof(float));
+    mContext->Map(mVertexBuffer.Get(), 0, map_type, 0, &ms);
+    memcpy((char*)ms.pData + batch_offset, buf_vbo, size);
     mContext->Unmap(mVertexBuffer.Get(), 0);
-
-    uint32_t stride = mShaderProgram->numFloats * sizeof(float);
-    uint32_t offset = 0;
+    mVertexBufferOffset = batch_offset + size;
 
     if (mLastVertexBufferStride != stride) {
         mLastVertexBufferStride = stride;
@@ -816,7 +862,7 @@ void GfxRenderingAPIDX11::DrawTriangles(float buf_vbo[], size_t buf_vbo_len, siz
         mContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
     }
 
-    mContext->Draw(buf_vbo_num_tris * 3, 0);
+    mContext->Draw(buf_vbo_num_tris * 3, batch_offset / stride);
 }
 
 void GfxRenderingAPIDX11::OnResize() {
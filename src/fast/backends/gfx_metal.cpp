@@ -345,15 +345,17 @@ void GfxRenderingAPIMetal::SelectTexture(int tile, uint32_t texture_id) {
     mCurrentTextureIds[tile] = texture_id;
 }
 
-void GfxRenderingAPIMetal::UploadTexture(const uint8_t* rgba32_buf, uint32_t width, uint32_t height) {
-    if (width == 0 || height == 0) {
-        return;
+// Spare textures kept per size; enough to cover a few textures swapping between two sizes.
+static constexpr size_t kMaxSpareTexturesPerSize = 4;
+
+MTL::Texture* GfxRenderingAPIMetal::AcquireTexture(uint32_t width, uint32_t height) {
+    auto spares = mSpareTextures.find(width << 16 | height);
+    if (spares != mSpareTextures.end() && !spares->second.empty()) {
+        MTL::Texture* texture = spares->second.back();
+        spares->second.pop_back();
+        return texture;
     }
 
-    TextureDataMetal* texture_data = &mTextures[mCurrentTextureIds[mCurrentTile]];
-
-    NS::AutoreleasePool* autorelease_pool = NS::AutoreleasePool::alloc()->init();
-
     MTL::TextureDescriptor* texture_descriptor =
         MTL::TextureDescriptor::texture2DDescriptor(MTL::PixelFormatRGBA8Unorm, width, height, true);
     texture_descriptor->setArrayLength(1);
@@ -361,21 +363,43 @@ void GfxRenderingAPIMetal::UploadTexture(const uint8_t* rgba32_buf, uint32_t wid
     texture_descriptor->setSampleCount(1);
     texture_descriptor->setStorageMode(MTL::StorageModeShared);
 
+    return mDevice->newTexture(texture_descriptor);
+}
+
+void GfxRenderingAPIMetal::ParkTexture(MTL::Texture* texture) {
+    std::vector<MTL::Texture*>& spares = mSpareTextures[texture->width() << 16 | texture->height()];
+    if (spares.size() < kMaxSpareTexturesPerSize) {
+        spares.push_back(texture);
+    } else {
+        texture->release();
+    }
+}
+
+void GfxRenderingAPIMetal::UploadTexture(const uint8_t* rgba32_buf, uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0) {
+        return;
+    }
+
+    TextureDataMetal* texture_data = &mTextures[mCurrentTextureIds[mCurrentTile]];
+
+    NS::AutoreleasePool* autorelease_pool = NS::AutoreleasePool::alloc()->init();
+
     MTL::Region region = MTL::Region::Make2D(0, 0, width, height);
 
-    MTL::Texture* texture = texture_data->texture;
+    // Re-imports of a texture keep their size and only overwrite texels; a resize swaps in a texture of the new
+    // size, reusing one another id gave up when possible.
     if (texture_data->texture == nullptr || texture_data->texture->width() != width ||
         texture_data->texture->height() != height) {
-        if (texture_data->texture != nullptr)
-            texture_data->texture->release();
+        if (texture_data->texture != nullptr) {
+            ParkTexture(texture_data->texture);
+        }
 
-        texture = mDevice->newTexture(texture_descriptor);
+        texture_data->texture = AcquireTexture(width, height);
     }
 
     NS::UInteger bytes_per_pixel = 4;
     NS::UInteger bytes_per_row = bytes_per_pixel * width;
-    texture->replaceRegion(region, 0, rgba32_buf, bytes_per_row);
-    texture_data->texture = texture;
+    texture_data->texture->replaceRegion(region, 0, rgba32_buf, bytes_per_row);
 
     autorelease_pool->release();
 }
@@ -4,7 +4,10 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
+#include <algorithm>
+#include <iterator>
 #include <map>
 #include <unordered_map>
 
@@ -32,6 +35,9 @@ namespace Fast {
 // function pointer (prism::IncludeFunc); lambdas with captures cannot be used there.
 static std::shared_ptr<Ship::ResourceManager> sOGLResourceManager;
 
+// Room for many full interpreter batches, so the streaming vertex buffer is orphaned a few times per frame at most.
+static constexpr size_t kVertexBufferSize = 256 * 32 * 3 * sizeof(float) * 50;
+
 GfxRenderingAPIOGL::GfxRenderingAPIOGL(std::shared_ptr<Ship::ConsoleVariable> consoleVariable,
                                        std::shared_ptr<Ship::ResourceManager> resourceManager)
     : mConsoleVariable(std::move(consoleVariable)), mResourceManager(std::move(resourceManager)) {
@@ -65,23 +71,53 @@ static void VertexArraySetAttribs(ShaderProgram* prg) {
     }
 }
 
-void GfxRenderingAPIOGL::SetUniforms(ShaderProgram* prg) const {
-    glUniform1i(prg->frameCountLocation, mFrameCount);
-    glUniform1f(prg->noiseScaleLocation, mCurrentNoiseScale);
+bool GfxRenderingAPIOGL::ShouldIssue(bool isChanged) {
+    (isChanged ? mStateCalls.Issued : mStateCalls.Skipped)++;
+    return isChanged;
+}
+
+// Uploads a two-element int uniform if it differs from what the program already holds.
+template <typename ShouldIssueFn>
+static void SetUniformPair(GLint location, GLint (&cached)[2], const GLint (&values)[2], ShouldIssueFn shouldIssue) {
+    if (shouldIssue(cached[0] != values[0] || cached[1] != values[1])) {
+        cached[0] = values[0];
+        cached[1] = values[1];
+        glUniform1iv(location, 2, values);
+    }
+}
+
+void GfxRenderingAPIOGL::SetUniforms(ShaderProgram* prg) {
+    if (ShouldIssue(prg->uniforms.frameCount != mFrameCount)) {
+        prg->uniforms.frameCount = mFrameCount;
+        glUniform1i(prg->frameCountLocation, mFrameCount);
+    }
+    if (ShouldIssue(prg->uniforms.noiseScale != mCurrentNoiseScale)) {
+        prg->uniforms.noiseScale = mCurrentNoiseScale;
+        glUniform1f(prg->noiseScaleLocation, mCurrentNoiseScale);
+    }
 }
 
 void GfxRenderingAPIOGL::SetPerDrawUniforms() {
-    glUniform1f(mCurrentShaderProgram->prim_depth_location, mCurrentPrimDepth);
+    ShaderUniformCache& cache = mCurrentShaderProgram->uniforms;
+    if (ShouldIssue(cache.primDepth != mCurrentPrimDepth)) {
+        cache.primDepth = mCurrentPrimDepth;
+        glUniform1f(mCurrentShaderProgram->prim_depth_location, mCurrentPrimDepth);
+    }
 
     if (mCurrentShaderProgram->usedTextures[0] || mCurrentShaderProgram->usedTextures[1]) {
-        GLint filtering[2] = { textures[mCurrentTextureIds[0]].filtering, textures[mCurrentTextureIds[1]].filtering };
-        glUniform1iv(mCurrentShaderProgram->texture_filtering_location, 2, filtering);
+        const TextureInfo& tex0 = textures[mCurrentTextureIds[0]];
+        const TextureInfo& tex1 = textures[mCurrentTextureIds[1]];
+        auto shouldIssue = [this](bool isChanged) { return ShouldIssue(isChanged); };
+
+        const GLint filtering[2] = { tex0.filtering, tex1.filtering };
+        SetUniformPair(mCurrentShaderProgram->texture_filtering_location, cache.textureFiltering, filtering,
+                       shouldIssue);
 
-        GLint width[2] = { textures[mCurrentTextureIds[0]].width, textures[mCurrentTextureIds[1]].width };
-        glUniform1iv(mCurrentShaderProgram->texture_width_location, 2, width);
+        const GLint width[2] = { tex0.width, tex1.width };
+        SetUniformPair(mCurrentShaderProgram->texture_width_location, cache.textureWidth, width, shouldIssue);
 
-        GLint height[2] = { textures[mCurrentTextureIds[0]].height, textures[mCurrentTextureIds[1]].height };
-        glUniform1iv(mCurrentShaderProgram->texture_height_location, 2, height);
+        const GLint height[2] = { tex0.height, tex1.height };
+        SetUniformPair(mCurrentShaderProgram->texture_height_location, cache.textureHeight, height, shouldIssue);
     }
 }
 
@@ -99,7 +135,7 @@ void GfxRenderingAPIOGL::UnloadShader(ShaderProgram* old_prg) {
 void GfxRenderingAPIOGL::LoadShader(ShaderProgram* new_prg) {
     // if (!new_prg) return;
     mCurrentShaderProgram = new_prg;
-    if (new_prg != mLastLoadedShader) {
+    if (ShouldIssue(new_prg != mLastLoadedShader)) {
         glUseProgram(new_prg->openglProgramId);
         VertexArraySetAttribs(new_prg);
         mLastLoadedShader = new_prg;
@@ -407,6 +443,8 @@ static std::string BuildVsShader(const CCFeatures& cc_features) {
 
 void GfxRenderingAPIOGL::ClearShaderCache() {
     mShaderProgramPool.clear();
+    // A new program may be allocated where a cleared one used to be.
+    mLastLoadedShader = nullptr;
 }
 
 ShaderProgram* GfxRenderingAPIOGL::CreateAndLoadNewShader(uint64_t shader_id0, uint64_t shader_id1) {
@@ -556,37 +594,121 @@ void GfxRenderingAPIOGL::ShaderGetInfo(struct ShaderProgram* prg, uint8_t* numIn
     usedTextures[1] = prg->usedTextures[1];
 }
 
+// Spare texture objects kept per size; enough to cover a few textures swapping between two sizes.
+static constexpr size_t kMaxSpareTexturesPerSize = 4;
+
+static uint32_t TextureSizeKey(uint32_t width, uint32_t height) {
+    return width << 16 | height;
+}
+
 GLuint GfxRenderingAPIOGL::NewTexture() {
-    GLuint ret;
-    glGenTextures(1, &ret);
-    textures.resize(std::max(textures.size(), (size_t)ret + 1));
-    return ret;
+    uint32_t id;
+    if (!mFreeTextureIds.empty()) {
+        id = mFreeTextureIds.back();
+        mFreeTextureIds.pop_back();
+    } else {
+        id = textures.size();
+        textures.emplace_back();
+    }
+    textures[id] = {};
+    return id;
 }
 
 void GfxRenderingAPIOGL::DeleteTexture(uint32_t texID) {
-    glDeleteTextures(1, &texID);
+    if (texID == 0 || texID >= textures.size()) {
+        return;
+    }
+
+    TextureInfo& info = textures[texID];
+    if (info.object != 0) {
+        ParkTextureObject(info.object, info.width, info.height);
+    }
+    info = {};
+    mFreeTextureIds.push_back(texID);
 }
 
-void GfxRenderingAPIOGL::SelectTexture(int tile, GLuint texture_id) {
-    if (mLastActiveTexture != tile) {
-        mLastActiveTexture = tile;
-        glActiveTexture(GL_TEXTURE0 + tile);
+void GfxRenderingAPIOGL::BindTexture(int unit, GLuint object) {
+    if (ShouldIssue(mLastActiveTexture != unit)) {
+        mLastActiveTexture = unit;
+        glActiveTexture(GL_TEXTURE0 + unit);
+    }
+    if (ShouldIssue(mLastBoundTextures[unit] != object)) {
+        mLastBoundTextures[unit] = object;
+        glBindTexture(GL_TEXTURE_2D, object);
     }
-    if (mLastBoundTextures[tile] != texture_id) {
-        mLastBoundTextures[tile] = texture_id;
-        glBindTexture(GL_TEXTURE_2D, texture_id);
+}
+
+void GfxRenderingAPIOGL::SelectTexture(int tile, GLuint texture_id) {
+    BindTexture(tile, textures[texture_id].object);
+    if (mHasSamplerObjects) {
+        // Sampling state belongs to the texture, so the unit follows whatever sampler it was last given.
+        BindSampler(tile, textures[texture_id].sampler);
     }
     mCurrentTextureIds[tile] = texture_id;
     mCurrentTile = tile;
 }
 
+void GfxRenderingAPIOGL::ParkTextureObject(GLuint object, uint32_t width, uint32_t height) {
+    std::vector<GLuint>& spares = mSpareTextures[TextureSizeKey(width, height)];
+    if (spares.size() < kMaxSpareTexturesPerSize) {
+        spares.push_back(object);
+        return;
+    }
+
+    glDeleteTextures(1, &object);
+    // Deleting a bound texture reverts its units to texture 0.
+    for (GLuint& boundTexture : mLastBoundTextures) {
+        if (boundTexture == object) {
+            boundTexture = 0;
+        }
+    }
+}
+
+void GfxRenderingAPIOGL::ReplaceTextureStorage(TextureInfo& info, uint32_t width, uint32_t height) {
+    if (info.object != 0) {
+        ParkTextureObject(info.object, info.width, info.height);
+    }
+    info.width = width;
+    info.height = height;
+
+    auto spares = mSpareTextures.find(TextureSizeKey(width, height));
+    if (spares != mSpareTextures.end() && !spares->second.empty()) {
+        info.object = spares->second.back();
+        spares->second.pop_back();
+        BindTexture(mCurrentTile, info.object);
+    } else {
+        glGenTextures(1, &info.object);
+        BindTexture(mCurrentTile, info.object);
+        if (mHasSamplerObjects) {
+            // Draws go through sampler objects; these only apply where the texture is sampled without one (ImGui).
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        }
+        if (mHasTextureStorage) {
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+        } else {
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        }
+    }
+
+    if (!mHasSamplerObjects) {
+        // The object's own parameters are the sampling state, and a parked one still has its previous owner's.
+        SetTextureParameters(info.samplerKey);
+    }
+}
+
 void GfxRenderingAPIOGL::UploadTexture(const uint8_t* rgba32_buf, uint32_t width, uint32_t height) {
     if (width == 0 || height == 0) {
         return;
     }
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba32_buf);
-    textures[mCurrentTextureIds[mCurrentTile]].width = width;
-    textures[mCurrentTextureIds[mCurrentTile]].height = height;
+
+    // Re-imports of a texture (animated or evicted and reloaded) keep their size, so in the common case this
+    // only updates texels in place and never reallocates storage.
+    TextureInfo& info = textures[mCurrentTextureIds[mCurrentTile]];
+    if (info.object == 0 || info.width != width || info.height != height) {
+        ReplaceTextureStorage(info, width, height);
+    }
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, rgba32_buf);
 }
 
 #ifdef USE_OPENGLES
@@ -607,17 +729,90 @@ static uint32_t gfx_cm_to_opengl(uint32_t val) {
     return 0;
 }
 
+// Packs a (filter, wrap S, wrap T) combination into an index of mSamplers.
+static uint8_t SamplerKey(bool linearFilter, uint32_t cms, uint32_t cmt) {
+    return (linearFilter ? 16 : 0) | (cms & 3) << 2 | (cmt & 3);
+}
+
+static GLint SamplerKeyFilter(uint8_t samplerKey) {
+    return (samplerKey & 16) != 0 ? GL_LINEAR : GL_NEAREST;
+}
+
+GLuint GfxRenderingAPIOGL::GetSampler(uint8_t samplerKey) {
+    GLuint& sampler = mSamplers[samplerKey];
+    if (sampler == 0) {
+        glGenSamplers(1, &sampler);
+        glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, SamplerKeyFilter(samplerKey));
+        glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, SamplerKeyFilter(samplerKey));
+        glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, gfx_cm_to_opengl(samplerKey >> 2 & 3));
+        glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, gfx_cm_to_opengl(samplerKey & 3));
+    }
+    return sampler;
+}
+
+void GfxRenderingAPIOGL::SetTextureParameters(uint8_t samplerKey) {
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, SamplerKeyFilter(samplerKey));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, SamplerKeyFilter(samplerKey));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, gfx_cm_to_opengl(samplerKey >> 2 & 3));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, gfx_cm_to_opengl(samplerKey & 3));
+}
+
+void GfxRenderingAPIOGL::BindSampler(int unit, GLuint sampler) {
+    if (ShouldIssue(mLastBoundSamplers[unit] != sampler)) {
+        mLastBoundSamplers[unit] = sampler;
+        glBindSampler(unit, sampler);
+    }
+}
+
 void GfxRenderingAPIOGL::SetSamplerParameters(int tile, bool linear_filter, uint32_t cms, uint32_t cmt) {
-    if (mLastActiveTexture != tile) {
-        mLastActiveTexture = tile;
-        glActiveTexture(GL_TEXTURE0 + tile);
+    TextureInfo& info = textures[mCurrentTextureIds[tile]];
+    info.filtering = !linear_filter ? FILTER_LINEAR : FILTER_THREE_POINT;
+    const uint8_t samplerKey = SamplerKey(linear_filter && mCurrentFilterMode == FILTER_LINEAR, cms, cmt);
+    if (mHasSamplerObjects) {
+        info.samplerKey = samplerKey;
+        info.sampler = GetSampler(samplerKey);
+        BindSampler(tile, info.sampler);
+        return;
+    }
+
+    // Without sampler objects the parameters live on the texture object, so they are only respecified when they
+    // change. A texture without storage yet gets them when ReplaceTextureStorage() gives it an object.
+    if (info.object != 0 && ShouldIssue(info.samplerKey != samplerKey)) {
+        BindTexture(tile, info.object);
+        SetTextureParameters(samplerKey);
+    }
+    info.samplerKey = samplerKey;
+}
+
+void GfxRenderingAPIOGL::SetScissorTest(bool isEnabled) {
+    const int8_t val = isEnabled ? 1 : 0;
+    if (ShouldIssue(mLastScissorEnabled != val)) {
+        mLastScissorEnabled = val;
+        if (isEnabled) {
+            glEnable(GL_SCISSOR_TEST);
+        } else {
+            glDisable(GL_SCISSOR_TEST);
+        }
+    }
+}
+
+void GfxRenderingAPIOGL::SetScissorBox(GLint x, GLint y, GLint width, GLint height) {
+    if (ShouldIssue(mLastScissor[0] != x || mLastScissor[1] != y || mLastScissor[2] != width ||
+                    mLastScissor[3] != height)) {
+        mLastScissor[0] = x;
+        mLastScissor[1] = y;
+        mLastScissor[2] = width;
+        mLastScissor[3] = height;
+        glScissor(x, y, width, height);
+    }
+}
+
+void GfxRenderingAPIOGL::SetDepthMask(bool isEnabled) {
+    const int8_t val = isEnabled ? 1 : 0;
+    if (ShouldIssue(mLastDepthMaskEnabled != val)) {
+        mLastDepthMaskEnabled = val;
+        glDepthMask(isEnabled ? GL_TRUE : GL_FALSE);
     }
-    const GLint filter = linear_filter && mCurrentFilterMode == FILTER_LINEAR ? GL_LINEAR : GL_NEAREST;
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
-    textures[mCurrentTextureIds[tile]].filtering = !linear_filter ? FILTER_LINEAR : FILTER_THREE_POINT;
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, gfx_cm_to_opengl(cms));
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, gfx_cm_to_opengl(cmt));
 }
 
 void GfxRenderingAPIOGL::SetDepthTestAndMask(bool depth_test, bool z_upd) {
@@ -637,16 +832,23 @@ void GfxRenderingAPIOGL::SetZmodeDecal(bool zmode_decal) {
 }
 
 void GfxRenderingAPIOGL::SetViewport(int x, int y, int width, int height) {
-    glViewport(x, y, width, height);
+    if (ShouldIssue(mLastViewport[0] != x || mLastViewport[1] != y || mLastViewport[2] != width ||
+                    mLastViewport[3] != height)) {
+        mLastViewport[0] = x;
+        mLastViewport[1] = y;
+        mLastViewport[2] = width;
+        mLastViewport[3] = height;
+        glViewport(x, y, width, height);
+    }
 }
 
 void GfxRenderingAPIOGL::SetScissor(int x, int y, int width, int height) {
-    glScissor(x, y, width, height);
+    SetScissorBox(x, y, width, height);
 }
 
 void GfxRenderingAPIOGL::SetUseAlpha(bool use_alpha) {
     int8_t val = use_alpha ? 1 : 0;
-    if (mLastBlendEnabled != val) {
+    if (ShouldIssue(mLastBlendEnabled != val)) {
         mLastBlendEnabled = val;
         if (use_alpha) {
             glEnable(GL_BLEND);
@@ -657,19 +859,26 @@ void GfxRenderingAPIOGL::SetUseAlpha(bool use_alpha) {
 }
 
 void GfxRenderingAPIOGL::DrawTriangles(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_tris) {
-    if (mCurrentDepthTest != mLastDepthTest || mCurrentDepthMask != mLastDepthMask) {
-        mLastDepthTest = mCurrentDepthTest;
-        mLastDepthMask = mCurrentDepthMask;
-
-        if (mCurrentDepthTest || mLastDepthMask) {
+    // Depth writes need the depth test enabled, so a mask-only draw tests with GL_ALWAYS.
+    const int8_t depthEnabled = mCurrentDepthTest || mCurrentDepthMask ? 1 : 0;
+    if (ShouldIssue(mLastDepthTestEnabled != depthEnabled)) {
+        mLastDepthTestEnabled = depthEnabled;
+        if (depthEnabled) {
             glEnable(GL_DEPTH_TEST);
-            glDepthMask(mLastDepthMask ? GL_TRUE : GL_FALSE);
-            glDepthFunc(mCurrentDepthTest ? (mCurrentZmodeDecal ? GL_LEQUAL : GL_LESS) : GL_ALWAYS);
         } else {
             glDisable(GL_DEPTH_TEST);
         }
     }
+    if (depthEnabled) {
+        SetDepthMask(mCurrentDepthMask);
+        const GLenum depthFunc = mCurrentDepthTest ? (mCurrentZmodeDecal ? GL_LEQUAL : GL_LESS) : GL_ALWAYS;
+        if (ShouldIssue(mLastDepthFunc != depthFunc)) {
+            mLastDepthFunc = depthFunc;
+            glDepthFunc(depthFunc);
+        }
+    }
 
+    // The polygon offset reads a CVar, so it is only recomputed when the decal mode toggles.
     if (mCurrentZmodeDecal != mLastZmodeDecal) {
         mLastZmodeDecal = mCurrentZmodeDecal;
         if (mCurrentZmodeDecal) {
@@ -698,19 +907,52 @@ void GfxRenderingAPIOGL::DrawTriangles(float buf_vbo[], size_t buf_vbo_len, size
                 default:
                     SSDB = -2;
             }
-            glPolygonOffset(SSDB, -2);
-            glEnable(GL_POLYGON_OFFSET_FILL);
-        } else {
-            glPolygonOffset(0, 0);
+            if (ShouldIssue(mLastPolygonOffset[0] != SSDB || mLastPolygonOffset[1] != -2)) {
+                mLastPolygonOffset[0] = SSDB;
+                mLastPolygonOffset[1] = -2;
+                glPolygonOffset(SSDB, -2);
+            }
+            if (ShouldIssue(mLastPolygonOffsetEnabled != 1)) {
+                mLastPolygonOffsetEnabled = 1;
+                glEnable(GL_POLYGON_OFFSET_FILL);
+            }
+        } else if (ShouldIssue(mLastPolygonOffsetEnabled != 0)) {
+            // The offset only applies while GL_POLYGON_OFFSET_FILL is enabled, so it can stay as is.
+            mLastPolygonOffsetEnabled = 0;
             glDisable(GL_POLYGON_OFFSET_FILL);
         }
     }
 
     SetPerDrawUniforms();
 
-    // printf("flushing %d tris\n", buf_vbo_num_tris);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * buf_vbo_len, buf_vbo, GL_STREAM_DRAW);
-    glDrawArrays(GL_TRIANGLES, 0, 3 * buf_vbo_num_tris);
+    // Each flush is appended to the streaming buffer instead of respecifying it, starting on a whole vertex of
+    // the current layout so the attribute pointers set at shader load stay valid.
+    const size_t stride = mCurrentShaderProgram->numFloats * sizeof(float);
+    const size_t size = sizeof(float) * buf_vbo_len;
+    size_t offset = (mVertexBufferOffset + stride - 1) / stride * stride;
+    if (offset + size > kVertexBufferSize) {
+        // Orphan the storage: queued draws keep reading the old copy while new vertices go to a fresh one.
+        glBufferData(GL_ARRAY_BUFFER, kVertexBufferSize, nullptr, GL_STREAM_DRAW);
+        offset = 0;
+    }
+    // Nothing queued reads the range past mVertexBufferOffset, so it is written without waiting for the GPU.
+    // glBufferSubData may instead stall until draws still reading this buffer have finished.
+    void* mapped = nullptr;
+    if (mHasMapBufferRange) {
+        mapped = glMapBufferRange(GL_ARRAY_BUFFER, offset, size,
+                                  GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    }
+    if (mapped != nullptr) {
+        memcpy(mapped, buf_vbo, size);
+        if (glUnmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE) {
+            // The store was lost (e.g. a display mode change); the range is undefined until written again.
+            glBufferSubData(GL_ARRAY_BUFFER, offset, size, buf_vbo);
+        }
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, offset, size, buf_vbo);
+    }
+    glDrawArrays(GL_TRIANGLES, offset / stride, 3 * buf_vbo_num_tris);
+    mVertexBufferOffset = offset + size;
 }
 
 void GfxRenderingAPIOGL::Init() {
@@ -720,6 +962,8 @@ void GfxRenderingAPIOGL::Init() {
 
     glGenBuffers(1, &mOpenglVbo);
     glBindBuffer(GL_ARRAY_BUFFER, mOpenglVbo);
+    glBufferData(GL_ARRAY_BUFFER, kVertexBufferSize, nullptr, GL_STREAM_DRAW);
+    mVertexBufferOffset = 0;
 
 #if defined(__APPLE__) || defined(USE_OPENGLES)
     glGenVertexArrays(1, &mOpenglVao);
@@ -733,6 +977,33 @@ void GfxRenderingAPIOGL::Init() {
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     mFrameBuffers.resize(1); // for the default screen buffer
+    textures.resize(1);      // texture id 0 samples nothing
+
+#ifdef USE_OPENGLES
+    // All are core in OpenGL ES 3.0.
+    mHasTextureStorage = true;
+    mHasSamplerObjects = true;
+    mHasMapBufferRange = true;
+#else
+    GLint glMajor = 0;
+    GLint glMinor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &glMajor);
+    glGetIntegerv(GL_MINOR_VERSION, &glMinor);
+    mHasTextureStorage = glMajor > 4 || (glMajor == 4 && glMinor >= 2);
+    mHasSamplerObjects = glMajor > 3 || (glMajor == 3 && glMinor >= 3);
+    mHasMapBufferRange = glMajor >= 3;
+    GLint extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    for (GLint i = 0; i < extensionCount && !(mHasTextureStorage && mHasSamplerObjects && mHasMapBufferRange); i++) {
+        const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (extension == nullptr) {
+            continue;
+        }
+        mHasTextureStorage = mHasTextureStorage || strcmp(extension, "GL_ARB_texture_storage") == 0;
+        mHasSamplerObjects = mHasSamplerObjects || strcmp(extension, "GL_ARB_sampler_objects") == 0;
+        mHasMapBufferRange = mHasMapBufferRange || strcmp(extension, "GL_ARB_map_buffer_range") == 0;
+    }
+#endif
 
     glGenRenderbuffers(1, &mPixelDepthRb);
     glBindRenderbuffer(GL_RENDERBUFFER, mPixelDepthRb);
@@ -756,6 +1027,8 @@ void GfxRenderingAPIOGL::OnResize() {
 
 void GfxRenderingAPIOGL::StartFrame() {
     mFrameCount++;
+    mLastFrameStateCalls = mStateCalls;
+    mStateCalls = {};
 }
 
 void GfxRenderingAPIOGL::EndFrame() {
@@ -768,11 +1041,11 @@ void GfxRenderingAPIOGL::FinishRender() {
 int GfxRenderingAPIOGL::CreateFramebuffer() {
     GLuint clrbuf;
     glGenTextures(1, &clrbuf);
-    glBindTexture(GL_TEXTURE_2D, clrbuf);
+    BindTexture(0, clrbuf);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    BindTexture(0, 0);
 
     GLuint clrbufMsaa;
     glGenRenderbuffers(1, &clrbufMsaa);
@@ -793,6 +1066,9 @@ int GfxRenderingAPIOGL::CreateFramebuffer() {
     mFrameBuffers[i].clrbuf = clrbuf;
     mFrameBuffers[i].clrbufMsaa = clrbufMsaa;
     mFrameBuffers[i].rbo = rbo;
+    mFrameBuffers[i].texture_id = NewTexture();
+    // The color buffer is resized in place by UpdateFramebufferParameters, so it is never parked.
+    textures[mFrameBuffers[i].texture_id].object = clrbuf;
 
     return i;
 }
@@ -811,9 +1087,9 @@ void GfxRenderingAPIOGL::UpdateFramebufferParameters(int fb_id, uint32_t width,
     if (fb_id != 0) {
         if (fb.width != width || fb.height != height || fb.msaa_level != msaa_level) {
             if (msaa_level <= 1) {
-                glBindTexture(GL_TEXTURE_2D, fb.clrbuf);
+                BindTexture(0, fb.clrbuf);
                 glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, NULL);
-                glBindTexture(GL_TEXTURE_2D, 0);
+                BindTexture(0, 0);
                 glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, fb.clrbuf, 0);
             } else {
                 glBindRenderbuffer(GL_RENDERBUFFER, fb.clrbufMsaa);
@@ -859,37 +1135,32 @@ void GfxRenderingAPIOGL::StartDrawToFramebuffer(int fb_id, float noise_scale) {
 }
 
 void GfxRenderingAPIOGL::ClearFramebuffer(bool color, bool depth) {
-    if (mLastScissorEnabled != 0) {
-        mLastScissorEnabled = 0;
-        glDisable(GL_SCISSOR_TEST);
-    }
-    glDepthMask(GL_TRUE);
+    SetScissorTest(false);
+    // The next draw restores the mask it needs through the shadow state.
+    SetDepthMask(true);
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
     glClear((color ? GL_COLOR_BUFFER_BIT : 0) | (depth ? GL_DEPTH_BUFFER_BIT : 0));
-    glDepthMask(mCurrentDepthMask ? GL_TRUE : GL_FALSE);
-    if (mLastScissorEnabled != 1) {
-        mLastScissorEnabled = 1;
-        glEnable(GL_SCISSOR_TEST);
-    }
+    SetScissorTest(true);
 }
 
 void GfxRenderingAPIOGL::ClearDepthRegion(int x, int y, int w, int h) {
     // Save current scissor state so callers don't need to manually invalidate.
     GLint prevScissor[4];
-    GLboolean scissorWasEnabled = glIsEnabled(GL_SCISSOR_TEST);
-    glGetIntegerv(GL_SCISSOR_BOX, prevScissor);
+    if (mLastScissor[2] < 0) {
+        glGetIntegerv(GL_SCISSOR_BOX, prevScissor);
+    } else {
+        std::copy(std::begin(mLastScissor), std::end(mLastScissor), prevScissor);
+    }
+    const bool scissorWasEnabled = mLastScissorEnabled < 0 ? glIsEnabled(GL_SCISSOR_TEST) : mLastScissorEnabled;
 
-    glEnable(GL_SCISSOR_TEST);
-    glScissor(x, y, w, h);
-    glDepthMask(GL_TRUE);
+    SetScissorTest(true);
+    SetScissorBox(x, y, w, h);
+    SetDepthMask(true);
     glClear(GL_DEPTH_BUFFER_BIT);
-    glDepthMask(mCurrentDepthMask ? GL_TRUE : GL_FALSE);
 
     // Restore previous scissor state.
-    glScissor(prevScissor[0], prevScissor[1], prevScissor[2], prevScissor[3]);
-    if (!scissorWasEnabled) {
-        glDisable(GL_SCISSOR_TEST);
-    }
+    SetScissorBox(prevScissor[0], prevScissor[1], prevScissor[2], prevScissor[3]);
+    SetScissorTest(scissorWasEnabled);
 }
 
 void GfxRenderingAPIOGL::ResolveMSAAColorBuffer(int fb_id_target, int fb_id_source) {
@@ -899,19 +1170,13 @@ void GfxRenderingAPIOGL::ResolveMSAAColorBuffer(int fb_id_target, int fb_id_sour
     glBindFramebuffer(GL_READ_FRAMEBUFFER, fb_src.fbo);
 
     // Disabled for blit
-    if (mLastScissorEnabled != 0) {
-        mLastScissorEnabled = 0;
-        glDisable(GL_SCISSOR_TEST);
-    }
+    SetScissorTest(false);
 
     glBlitFramebuffer(0, 0, fb_src.width, fb_src.height, 0, 0, fb_dst.width, fb_dst.height, GL_COLOR_BUFFER_BIT,
                       GL_NEAREST);
     glBindFramebuffer(GL_FRAMEBUFFER, mCurrentFrameBuffer);
 
-    if (mLastScissorEnabled != 1) {
-        mLastScissorEnabled = 1;
-        glEnable(GL_SCISSOR_TEST);
-    }
+    SetScissorTest(true);
 }
 
 void* GfxRenderingAPIOGL::GetFramebufferTextureId(int fb_id) {
@@ -921,14 +1186,7 @@ void* GfxRenderingAPIOGL::GetFramebufferTextureId(int fb_id) {
 void GfxRenderingAPIOGL::SelectTextureFb(int fb_id) {
     // glDisable(GL_DEPTH_TEST);
     int tile = 0;
-    GLuint texId = mFrameBuffers[fb_id].clrbuf;
-    // Ensure the textures metadata vector can hold this FB texture handle.
-    // FB color buffers are created outside NewTexture(), so the vector may
-    // not have been resized for them yet.
-    if (texId >= textures.size()) {
-        textures.resize((size_t)texId + 1);
-    }
-    SelectTexture(tile, texId);
+    SelectTexture(tile, mFrameBuffers[fb_id].texture_id);
 }
 
 void GfxRenderingAPIOGL::CopyFramebuffer(int fb_dst_id, int fb_src_id, int srcX0, int srcY0, int srcX1, int srcY1,
@@ -953,10 +1211,7 @@ void GfxRenderingAPIOGL::CopyFramebuffer(int fb_dst_id, int fb_src_id, int srcX0
     }
 
     // Disabled for blit
-    if (mLastScissorEnabled != 0) {
-        mLastScissorEnabled = 0;
-        glDisable(GL_SCISSOR_TEST);
-    }
+    SetScissorTest(false);
 
     // For msaa enabled buffers we can't perform a scaled blit to a simple sample buffer
     // First do an unscaled blit to a msaa resolved buffer
@@ -997,10 +1252,7 @@ void GfxRenderingAPIOGL::CopyFramebuffer(int fb_dst_id, int fb_src_id, int srcX0
 
     glReadBuffer(GL_BACK);
 
-    if (mLastScissorEnabled != 1) {
-        mLastScissorEnabled = 1;
-        glEnable(GL_SCISSOR_TEST);
-    }
+    SetScissorTest(true);
 }
 
 void GfxRenderingAPIOGL::ReadFramebufferToCPU(int fb_id, uint32_t width, uint32_t height, uint16_t* rgba16_buf) {
@@ -1063,7 +1315,7 @@ GfxRenderingAPIOGL::GetPixelDepth(int fb_id, const std::set<std::pair<float, flo
         glBindFramebuffer(GL_READ_FRAMEBUFFER, fb.fbo);
         glBindFramebuffer(GL_DRAW_FRAMEBUFFER, mPixelDepthFb);
 
-        glDisable(GL_SCISSOR_TEST); // needed for the blit operation
+        SetScissorTest(false); // needed for the blit operation
 
         {
             size_t i = 0;
@@ -1111,7 +1363,12 @@ void GfxRenderingAPIOGL::SetSrgbMode() {
 }
 
 ImTextureID GfxRenderingAPIOGL::GetTextureById(int id) {
-    return reinterpret_cast<ImTextureID>(id);
+    const GLuint object = id >= 0 && (size_t)id < textures.size() ? textures[id].object : 0;
+    return (ImTextureID)(uintptr_t)object;
+}
+
+GfxStateCallStats GfxRenderingAPIOGL::GetStateCallStats() {
+    return mLastFrameStateCalls;
 }
 } // namespace Fast
 #endif
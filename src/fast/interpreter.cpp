@@ -134,7 +134,7 @@ static constexpr float N64_PRIM_DEPTH_MAX = 32767.0f;
 
 void Interpreter::Flush() {
     if (mBufVboLen > 0) {
-        mRapi->SetCurrentPrimDepth((float)mRdp->prim_depth / N64_PRIM_DEPTH_MAX);
+        mRapi->SetCurrentPrimDepth((float)mRenderingState.prim_depth / N64_PRIM_DEPTH_MAX);
         mRapi->DrawTriangles(mBufVbo, mBufVboLen, mBufVboNumTris);
         mBufVboLen = 0;
         mBufVboNumTris = 0;
@@ -453,6 +453,7 @@ void Interpreter::TextureCacheClear() {
     mTextureCache.map.reserve(TEXTURE_CACHE_MAX_SIZE);
     // Null rendering-state pointers — they pointed into map nodes that are now freed.
     std::fill(std::begin(mRenderingState.mTextures), std::end(mRenderingState.mTextures), nullptr);
+    std::fill(std::begin(mRenderingState.mBoundTextures), std::end(mRenderingState.mBoundTextures), nullptr);
 }
 
 void Interpreter::ShaderCacheClear() {
@@ -464,6 +465,14 @@ bool Interpreter::TextureCacheLookup(int i, const TextureCacheKey& key) {
     TextureCacheNode** n = &mRenderingState.mTextures[i];
 
     if (it != mTextureCache.map.end()) {
+        // Display lists reload the same texture all the time; only a different binding ends the current batch.
+        // Batching across bindings would need texture arrays. All layers of an array share one sampler, while
+        // filter and wrap modes are set per texture, and GfxSpTri1 picks the clamp-emulating shader variant from
+        // each texture's tile and loaded sizes. Game shaders supplied through gfx_get_shader have no layer input.
+        if (mRenderingState.mBoundTextures[i] != &*it) {
+            Flush();
+            mRenderingState.mBoundTextures[i] = &*it;
+        }
         mRapi->SelectTexture(i, it->second.texture_id);
         *n = &*it;
         mTextureCache.lru.splice(mTextureCache.lru.end(), mTextureCache.lru,
@@ -471,6 +480,9 @@ bool Interpreter::TextureCacheLookup(int i, const TextureCacheKey& key) {
         return true;
     }
 
+    // Queued triangles may sample the texture that is about to be evicted or re-uploaded.
+    Flush();
+
     if (mTextureCache.map.size() >= TEXTURE_CACHE_MAX_SIZE) {
         // Remove the texture that was least recently used
         it = mTextureCache.lru.front().it;
@@ -478,6 +490,8 @@ bool Interpreter::TextureCacheLookup(int i, const TextureCacheKey& key) {
         for (int j = 0; j < SHADER_MAX_TEXTURES; j++) {
             if (mRenderingState.mTextures[j] == &*it)
                 mRenderingState.mTextures[j] = nullptr;
+            if (mRenderingState.mBoundTextures[j] == &*it)
+                mRenderingState.mBoundTextures[j] = nullptr;
         }
         mTextureCache.map.erase(it);
         mTextureCache.lru.pop_front();
@@ -499,6 +513,7 @@ bool Interpreter::TextureCacheLookup(int i, const TextureCacheKey& key) {
     mRapi->SelectTexture(i, texture_id);
     mRapi->SetSamplerParameters(i, false, 0, 0);
     *n = node;
+    mRenderingState.mBoundTextures[i] = node;
     return false;
 }
 
@@ -520,6 +535,8 @@ void Interpreter::TextureCacheDelete(const uint8_t* origAddr) {
                 for (int j = 0; j < SHADER_MAX_TEXTURES; j++) {
                     if (mRenderingState.mTextures[j] == &*it)
                         mRenderingState.mTextures[j] = nullptr;
+                    if (mRenderingState.mBoundTextures[j] == &*it)
+                        mRenderingState.mBoundTextures[j] = nullptr;
                 }
                 mTextureCache.lru.erase(it->second.lru_location);
                 mTextureCache.free_texture_ids.push_back(it->second.texture_id);
@@ -1182,6 +1199,7 @@ void Interpreter::ImportTexture(int i, int tile, bool importReplacement) {
         if (fbIt != mFbTextures.end()) {
             Flush();
             mRapi->SelectTextureFb(fbIt->second);
+            mRenderingState.mBoundTextures[i] = nullptr;
             mRdp->textures_changed[i] = false;
             return;
         }
@@ -1870,7 +1888,7 @@ void Interpreter::GfxSpTri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx
 
         if (comb->usedTextures[i]) {
             if (mRdp->textures_changed[i]) {
-                Flush();
+                // ImportTexture flushes only if the texture bound on this slot actually changes.
                 ImportTexture(i, tile, false);
                 if (mRdp->loaded_texture[i].masked) {
                     ImportTextureMask(SHADER_FIRST_MASK_TEXTURE + i, tile);
@@ -1982,6 +2000,11 @@ void Interpreter::GfxSpTri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx
         mRapi->LoadShader(prg);
         mRenderingState.mShaderProgram = prg;
     }
+    // Prim depth is a per-draw value, so only triangles that share it can be batched.
+    if (use_prim_depth && mRdp->prim_depth != mRenderingState.prim_depth) {
+        Flush();
+        mRenderingState.prim_depth = mRdp->prim_depth;
+    }
     if (use_alpha != mRenderingState.alpha_blend) {
         Flush();
         mRapi->SetUseAlpha(use_alpha);
@@ -4107,6 +4130,7 @@ bool gfx_set_timg_fb_handler_custom(F3DGfx** cmd0) {
 
     gfx->Flush();
     gfx->mRapi->SelectTextureFb((uint32_t)cmd->words.w1);
+    gfx->mRenderingState.mBoundTextures[0] = nullptr;
     gfx->mRdp->textures_changed[0] = false;
     gfx->mRdp->textures_changed[1] = false;
     return false;
@@ -5011,6 +5035,8 @@ void Interpreter::Run(Gfx* commands, const std::unordered_map<Mtx*, MtxF>& mtx_r
     mRdp->viewport_or_scissor_changed = true;
     mRenderingState.viewport = {};
     mRenderingState.scissor = {};
+    // Bindings may have changed outside the interpreter (GUI texture uploads) since the last frame.
+    std::fill(std::begin(mRenderingState.mBoundTextures), std::end(mRenderingState.mBoundTextures), nullptr);
 
     auto dbg = mGfxDebugger;
     g_exec_stack.start((F3DGfx*)commands);
@@ -5065,6 +5091,14 @@ void Interpreter::EndFrame() {
     mWapi->SwapBuffersBegin();
     mRapi->FinishRender();
     mWapi->SwapBuffersEnd();
+
+    // The frame is presented, so raw pointers handed out while building it are no longer in use. Trimming the
+    // resource cache only here keeps everything the display lists touched pinned until this point.
+    if (mResourceManager != nullptr) {
+        mResourceManager->EvictToBudget([this](Ship::IResource& resource) {
+            TextureCacheDelete(static_cast<const uint8_t*>(resource.GetRawPointer()));
+        });
+    }
 }
 
 void gfx_set_target_ucode(UcodeHandlers ucode) {
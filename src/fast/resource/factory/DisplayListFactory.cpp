@@ -4,6 +4,8 @@
 #include "libultraship/libultra/gbi.h"
 #include "fast/lus_gbi.h"
 #include <tinyxml2.h>
+#include <algorithm>
+#include <cstring>
 
 namespace Fast {
 std::unordered_map<std::string, uint32_t> renderModes = {
@@ -183,41 +185,48 @@ ResourceFactoryBinaryDisplayListV0::ReadResource(std::shared_ptr<Ship::File> fil
         reader->ReadInt8();
     }
 
-    size_t idx = 0;
-    while (true) {
-        Gfx command;
-        command.words.w0 = reader->ReadUInt32();
-        command.words.w1 = reader->ReadUInt32();
-
-        int8_t opcode = (int8_t)(command.words.w0 >> 24);
-        bool isExpanded = opcode == G_SETTIMG_OTR_HASH || opcode == G_DL_OTR_HASH || opcode == G_VTX_OTR_HASH ||
-                          opcode == G_BRANCH_Z_OTR || opcode == G_MARKER || opcode == G_MTX_OTR ||
-                          opcode == G_MOVEMEM_OTR;
+    // The command block is read straight out of the file buffer rather than word by word through the reader.
+    // Commands are stored as two 32-bit words, but Gfx words are pointer sized (and may carry trace data), so the
+    // buffer cannot be aliased; the words are widened (and byteswapped if needed) into a vector reserved up front.
+    const size_t start = reader->GetBaseAddress();
+    const char* data = file->Buffer->data() + start;
+    const size_t wordPairs = (file->Buffer->size() - start) / (2 * sizeof(uint32_t));
+    const bool swap = reader->GetEndianness() != Ship::Endianness::Native;
+    const int8_t endOpcode = GetEndOpcodeByUCode(ucode);
+
+    auto readWord = [data, swap](size_t index) {
+        uint32_t word;
+        memcpy(&word, data + index * sizeof(uint32_t), sizeof(uint32_t));
+        return swap ? BSWAP32(word) : word;
+    };
 
-        // These are 128-bit commands, so read an extra 64 bits...
-        if (isExpanded) {
-#ifdef USE_GBI_TRACE
-            command.words.trace.file = initData->Identifier.GetPath().c_str();
-            command.words.trace.idx = idx++;
-            command.words.trace.valid = true;
-#endif
-            displayList->Instructions.push_back(command);
-            command.words.w0 = reader->ReadUInt32();
-            command.words.w1 = reader->ReadUInt32();
+    // First pass: find the end of the list so the instruction vector is allocated exactly once.
+    size_t count = 0;
+    while (count < wordPairs) {
+        const int8_t opcode = (int8_t)(readWord(count * 2) >> 24);
+        // These are 128-bit commands, so they take an extra 64 bits...
+        const bool isExpanded = opcode == G_SETTIMG_OTR_HASH || opcode == G_DL_OTR_HASH ||
+                                opcode == G_VTX_OTR_HASH || opcode == G_BRANCH_Z_OTR || opcode == G_MARKER ||
+                                opcode == G_MTX_OTR || opcode == G_MOVEMEM_OTR;
+        count += isExpanded ? 2 : 1;
+        if (opcode == endOpcode) {
+            break;
         }
+    }
+    count = std::min(count, wordPairs);
 
+    displayList->Instructions.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        Gfx& command = displayList->Instructions[i];
+        command.words.w0 = readWord(i * 2);
+        command.words.w1 = readWord(i * 2 + 1);
 #ifdef USE_GBI_TRACE
         command.words.trace.file = initData->Identifier.GetPath().c_str();
-        command.words.trace.idx = idx++;
+        command.words.trace.idx = i;
         command.words.trace.valid = true;
 #endif
-
-        displayList->Instructions.push_back(command);
-
-        if (opcode == GetEndOpcodeByUCode(ucode)) {
-            break;
-        }
     }
+    reader->Seek(static_cast<int32_t>(count * 2 * sizeof(uint32_t)), Ship::SeekOffsetType::Current);
 
     return displayList;
 }
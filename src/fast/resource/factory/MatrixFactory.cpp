@@ -13,15 +13,11 @@ ResourceFactoryBinaryMatrixV0::ReadResource(std::shared_ptr<Ship::File> file,
     auto matrix = std::make_shared<Matrix>(initData);
     auto reader = std::get<std::shared_ptr<Ship::BinaryReader>>(file->Reader);
 
-    for (size_t i = 0; i < 4; i++) {
-        for (size_t j = 0; j < 4; j++) {
 #ifdef GBI_FLOATS
-            matrix->Matrx.mf[i][j] = reader->ReadFloat();
+    reader->ReadArray(&matrix->Matrx.mf[0][0], 16);
 #else
-            matrix->Matrx.m[i][j] = reader->ReadInt32();
+    reader->ReadArray(&matrix->Matrx.m[0][0], 16);
 #endif
-        }
-    }
 
     return matrix;
 }
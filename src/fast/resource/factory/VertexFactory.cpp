@@ -5,6 +5,12 @@
 #include <tinyxml2.h>
 
 namespace Fast {
+namespace {
+// ob[3], flag, tc[2], cn[4]
+using BinaryVtxLayout =
+    Ship::StructLayout<int16_t, int16_t, int16_t, uint16_t, int16_t, int16_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+} // namespace
+
 std::shared_ptr<Ship::IResource>
 ResourceFactoryBinaryVertexV0::ReadResource(std::shared_ptr<Ship::File> file,
                                             std::shared_ptr<Ship::ResourceInitData> initData) {
@@ -16,6 +22,12 @@ ResourceFactoryBinaryVertexV0::ReadResource(std::shared_ptr<Ship::File> file,
     auto reader = std::get<std::shared_ptr<Ship::BinaryReader>>(file->Reader);
 
     uint32_t count = reader->ReadUInt32();
+
+#ifndef GBI_FLOATS
+    // the in-memory Vtx matches the file record, so the whole list is read in one go
+    vertex->VertexList.resize(count);
+    reader->ReadStruct<BinaryVtxLayout>(vertex->VertexList.data(), count);
+#else
     vertex->VertexList.reserve(count);
 
     for (uint32_t i = 0; i < count; i++) {
@@ -32,6 +44,7 @@ ResourceFactoryBinaryVertexV0::ReadResource(std::shared_ptr<Ship::File> file,
         data.v.cn[3] = reader->ReadUByte();
         vertex->VertexList.push_back(data);
     }
+#endif
 
     return vertex;
 }
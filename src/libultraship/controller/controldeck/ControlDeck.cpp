@@ -69,6 +69,9 @@ void ControlDeck::WriteToOSContPad(OSContPad* pad) {
 
     mPads = pad;
 
+    // sample every gamepad once so all ports and mappings read the same frame of input
+    UpdateInputSnapshot();
+
     for (size_t i = 0; i < mPorts.size(); i++) {
         const std::shared_ptr<Ship::Controller> controller = mPorts[i]->GetConnectedController();
 
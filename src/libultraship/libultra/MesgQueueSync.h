@@ -0,0 +1,18 @@
+#ifndef PORT_MESG_QUEUE_SYNC_H
+#define PORT_MESG_QUEUE_SYNC_H
+
+#include "libultraship/libultra/message.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Posts the message registered for an OS event (osSetEventMesg / osViSetEvent)
+// without blocking. Safe to call from timer or backend threads.
+void __lusSendEventMesg(OSEvent event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,10 +1,64 @@
 #include "libultraship/libultraship.h"
+#include "MesgQueueSync.h"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+// OSMesgQueue keeps the libultra layout, so the synchronisation lives beside it:
+// a fixed pool of lock/condition-variable stripes, picked by hashing the queue's
+// address. Any queue works without registration (including ones on the stack),
+// nothing is allocated, and unrelated queues only share a stripe on a hash
+// collision, which costs at most a spurious wakeup.
+
+namespace {
+constexpr size_t kMesgQueueStripes = 64;
+
+struct MesgQueueStripe {
+    std::mutex Mutex;
+    std::condition_variable Changed;
+    int32_t Waiters = 0;
+};
+
+MesgQueueStripe sStripes[kMesgQueueStripes];
+std::mutex sEventMutex;
+
+MesgQueueStripe& StripeFor(const OSMesgQueue* mq) {
+    uint64_t hash = reinterpret_cast<uintptr_t>(mq);
+    hash ^= hash >> 17;
+    hash *= 0x9E3779B97F4A7C15ull;
+    return sStripes[(hash >> 32) % kMesgQueueStripes];
+}
+
+// Blocks on the stripe until pred() holds. Returns false without waiting for OS_MESG_NOBLOCK.
+template <typename Pred>
+bool WaitFor(MesgQueueStripe& stripe, std::unique_lock<std::mutex>& lock, int32_t flag, Pred pred) {
+    if (pred()) {
+        return true;
+    }
+    if (flag != OS_MESG_BLOCK) {
+        return false;
+    }
+    stripe.Waiters++;
+    stripe.Changed.wait(lock, pred);
+    stripe.Waiters--;
+    return true;
+}
+
+// Wakes waiters on the stripe after the queue changed; skipped when nobody sleeps on it.
+void NotifyChanged(MesgQueueStripe& stripe) {
+    if (stripe.Waiters > 0) {
+        stripe.Changed.notify_all();
+    }
+}
+} // namespace
 
 extern "C" {
 
 __OSEventState __osEventStateTab[OS_NUM_EVENTS] = { 0 };
 
 void osCreateMesgQueue(OSMesgQueue* mq, OSMesg* msgBuf, int32_t count) {
+    MesgQueueStripe& stripe = StripeFor(mq);
+    std::lock_guard<std::mutex> lock(stripe.Mutex);
     mq->validCount = 0;
     mq->first = 0;
     mq->msgCount = count;
@@ -13,47 +67,71 @@ void osCreateMesgQueue(OSMesgQueue* mq, OSMesg* msgBuf, int32_t count) {
 }
 
 int32_t osSendMesg(OSMesgQueue* mq, OSMesg msg, int32_t flag) {
-    int32_t index;
-    if (mq->validCount >= mq->msgCount) {
+    MesgQueueStripe& stripe = StripeFor(mq);
+    std::unique_lock<std::mutex> lock(stripe.Mutex);
+    if (!WaitFor(stripe, lock, flag, [mq] { return mq->validCount < mq->msgCount; })) {
         return -1;
     }
-    index = (mq->first + mq->validCount) % mq->msgCount;
+
+    int32_t index = (mq->first + mq->validCount) % mq->msgCount;
     mq->msg[index] = msg;
     mq->validCount++;
+    NotifyChanged(stripe);
 
     return 0;
 }
 
 int32_t osJamMesg(OSMesgQueue* mq, OSMesg msg, int32_t flag) {
-    if (mq->validCount == 0) {
+    MesgQueueStripe& stripe = StripeFor(mq);
+    std::unique_lock<std::mutex> lock(stripe.Mutex);
+    if (!WaitFor(stripe, lock, flag, [mq] { return mq->validCount < mq->msgCount; })) {
         return -1;
     }
 
     mq->first = (mq->first + mq->msgCount - 1) % mq->msgCount;
     mq->msg[mq->first] = msg;
     mq->validCount++;
+    NotifyChanged(stripe);
 
     return 0;
 }
 
 int32_t osRecvMesg(OSMesgQueue* mq, OSMesg* msg, int32_t flag) {
-    if (mq->validCount == 0) {
+    MesgQueueStripe& stripe = StripeFor(mq);
+    std::unique_lock<std::mutex> lock(stripe.Mutex);
+    if (!WaitFor(stripe, lock, flag, [mq] { return mq->validCount > 0; })) {
         return -1;
     }
+
     if (msg != NULL) {
         *msg = *(mq->first + mq->msg);
     }
     mq->first = (mq->first + 1) % mq->msgCount;
     mq->validCount--;
+    NotifyChanged(stripe);
 
     return 0;
 }
 
 void osSetEventMesg(OSEvent event, OSMesgQueue* mq, OSMesg msg) {
-
+    std::lock_guard<std::mutex> lock(sEventMutex);
     __OSEventState* es = &__osEventStateTab[event];
 
     es->queue = mq;
     es->msg = msg;
 }
-}
\ No newline at end of file
+
+void __lusSendEventMesg(OSEvent event) {
+    OSMesgQueue* queue;
+    OSMesg msg;
+    {
+        std::lock_guard<std::mutex> lock(sEventMutex);
+        queue = __osEventStateTab[event].queue;
+        msg = __osEventStateTab[event].msg;
+    }
+
+    if (queue != nullptr) {
+        osSendMesg(queue, msg, OS_MESG_NOBLOCK);
+    }
+}
+}
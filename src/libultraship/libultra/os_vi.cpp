@@ -1,27 +1,24 @@
 #include "libultraship/libultraship.h"
+#include "MesgQueueSync.h"
 
 extern "C" {
 
-Uint32 __lusViCallback(void* userdata, SDL_TimerID timerId, Uint32 interval) {
-    __OSEventState* es = &__osEventStateTab[OS_EVENT_VI];
-
-    if (es && es->queue) {
-        osSendMesg(es->queue, es->msg, OS_MESG_NOBLOCK);
-    }
+// One VI retrace at 60 Hz. The nanosecond timer keeps the period exact instead of
+// rounding to 16 ms, and posting through the message queue wakes any thread
+// blocked in osRecvMesg(OS_MESG_BLOCK) on the VI queue directly.
+static const Uint64 sViIntervalNs = SDL_NS_PER_SECOND / 60;
 
+Uint64 __lusViCallback(void* userdata, SDL_TimerID timerId, Uint64 interval) {
+    __lusSendEventMesg(OS_EVENT_VI);
     return interval;
 }
 
 void osCreateViManager(OSPri pri) {
-    SDL_AddTimer(16, &__lusViCallback, NULL);
+    SDL_AddTimerNS(sViIntervalNs, &__lusViCallback, NULL);
 }
 
 void osViSetEvent(OSMesgQueue* queue, OSMesg mesg, uint32_t c) {
-
-    __OSEventState* es = &__osEventStateTab[OS_EVENT_VI];
-
-    es->queue = queue;
-    es->msg = mesg;
+    osSetEventMesg(OS_EVENT_VI, queue, mesg);
 }
 
 void osViSwapBuffer(void* a) {
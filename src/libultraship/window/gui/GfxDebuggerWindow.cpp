@@ -10,6 +10,7 @@
 #include "fast/interpreter.h"
 #include "fast/Fast3dWindow.h"
 #include "fast/Fast3dGui.h"
+#include <algorithm>
 #include <optional>
 #ifdef GFX_DEBUG_DISASSEMBLER
 #include <gfxd.h>
@@ -40,6 +41,10 @@ void GfxDebuggerWindow::OnInit(const nlohmann::json& initArgs) {
 }
 
 void GfxDebuggerWindow::UpdateElement() {
+    // the next capture may reuse the same buffer with different contents, so drop the tree once the game resumes
+    if (mDisasRoot != nullptr && !mGfxDebugger->IsDebugging()) {
+        BuildDisasTree(nullptr);
+    }
 }
 
 // LUSTODO handle switching ucodes
@@ -50,61 +55,27 @@ static const char* GetOpName(int8_t op) {
 #define C0(pos, width) ((cmd->words.w0 >> (pos)) & ((1U << width) - 1))
 #define C1(pos, width) ((cmd->words.w1 >> (pos)) & ((1U << width) - 1))
 
-// static int s_dbgcnt = 0;
-void GfxDebuggerWindow::DrawDisasNode(const F3DGfx* cmd, std::vector<const F3DGfx*>& gfxPath,
-                                      float parentPosY = 0) const {
+// Decodes the display list starting at cmd into child nodes of parent (or root nodes when parent is -1). Labels
+// and resource names are resolved here, once, rather than every frame the tree is drawn.
+void GfxDebuggerWindow::DecodeDisasNodes(const F3DGfx* cmd, int32_t parent) {
     const F3DGfx* dlStart = cmd;
-    auto dbg = mGfxDebugger;
-
-    auto nodeWithText = [dbg, dlStart, parentPosY, this, &gfxPath](const F3DGfx* cmd, const std::string& text,
-                                                                   const F3DGfx* sub = nullptr) mutable {
-        gfxPath.push_back(cmd);
-
-        ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow;
-        if (dbg->HasBreakPoint(gfxPath)) {
-            flags |= ImGuiTreeNodeFlags_Selected;
-        }
-        if (sub == nullptr) {
-            flags |= ImGuiTreeNodeFlags_Leaf;
-        }
-
-        bool scrollTo = false;
-        float curPosY = ImGui::GetCursorPosY();
-        bool open = ImGui::TreeNodeEx((const void*)cmd, flags, "%p:%4d: %s", cmd,
-                                      (int)(((uintptr_t)cmd - (uintptr_t)dlStart) / sizeof(F3DGfx)), text.c_str());
-
-        if (ImGui::IsItemHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Left)) {
-            dbg->SetBreakPoint(gfxPath);
-        }
-
-        if (ImGui::BeginPopupContextItem(nullptr, ImGuiPopupFlags_MouseButtonRight)) {
-            if (ImGui::Selectable("Copy text")) {
-                SDL_SetClipboardText(text.c_str());
-            }
-            if (ImGui::Selectable("Copy address")) {
-                std::string address = fmt::format("0x{:x}", (uintptr_t)cmd);
-                SDL_SetClipboardText(address.c_str());
-            }
-            if (parentPosY > 0) {
-                scrollTo = ImGui::Selectable("Scroll to parent");
-            }
-            ImGui::EndPopup();
-        }
-
-        if (scrollTo) {
-            ImGui::SetScrollY(parentPosY);
-        }
-
-        if (open) {
-            if (sub) {
-                DrawDisasNode(sub, gfxPath, curPosY);
-            }
-            ImGui::TreePop();
-        }
-        gfxPath.pop_back();
+    const uint32_t depth = parent < 0 ? 0 : mDisasNodes[parent].Depth + 1;
+
+    auto nodeWithText = [this, dlStart, parent, depth](const F3DGfx* cmd, const std::string& text,
+                                                       const F3DGfx* sub = nullptr) {
+        DisasNode node;
+        node.Cmd = cmd;
+        node.Sub = sub;
+        node.Parent = parent;
+        node.Depth = depth;
+        node.Label = fmt::format("{}:{:4}: ", (const void*)cmd,
+                                 (int)(((uintptr_t)cmd - (uintptr_t)dlStart) / sizeof(F3DGfx)));
+        node.TextOffset = node.Label.size();
+        node.Label += text;
+        mDisasNodes.push_back(std::move(node));
     };
 
-    auto simpleNode = [dbg, nodeWithText](const F3DGfx* cmd, int8_t opcode) mutable {
+    auto simpleNode = [nodeWithText](const F3DGfx* cmd, int8_t opcode) mutable {
         const char* opname = GetOpName(opcode);
 
         if (opname) {
@@ -554,6 +525,158 @@ void GfxDebuggerWindow::DrawDisasNode(const F3DGfx* cmd, std::vector<const F3DGf
     }
 }
 
+void GfxDebuggerWindow::BuildDisasTree(const F3DGfx* dlist) {
+    mDisasNodes.clear();
+    mDisasRoot = dlist;
+    if (dlist != nullptr) {
+        DecodeDisasNodes(dlist, -1);
+    }
+    mDisasRootCount = static_cast<uint32_t>(mDisasNodes.size());
+    mDisasRowsDirty = true;
+    mSelectedDisasNode = FindDisasNode(mLastBreakPoint);
+}
+
+void GfxDebuggerWindow::ExpandDisasNode(uint32_t index) {
+    if (!mDisasNodes[index].ChildrenDecoded && mDisasNodes[index].Sub != nullptr) {
+        // children are appended, so every node's children stay contiguous
+        const size_t firstChild = mDisasNodes.size();
+        DecodeDisasNodes(mDisasNodes[index].Sub, static_cast<int32_t>(index));
+        mDisasNodes[index].FirstChild = static_cast<uint32_t>(firstChild);
+        mDisasNodes[index].ChildCount = static_cast<uint32_t>(mDisasNodes.size() - firstChild);
+        mDisasNodes[index].ChildrenDecoded = true;
+        mSelectedDisasNode = FindDisasNode(mLastBreakPoint);
+    }
+    mDisasNodes[index].Open = true;
+    mDisasRowsDirty = true;
+}
+
+void GfxDebuggerWindow::RebuildDisasRows() {
+    mDisasRows.clear();
+    std::stack<uint32_t> pending;
+    for (uint32_t i = mDisasRootCount; i > 0; i--) {
+        pending.push(i - 1);
+    }
+    while (!pending.empty()) {
+        const uint32_t index = pending.top();
+        pending.pop();
+        mDisasRows.push_back(index);
+
+        const DisasNode& node = mDisasNodes[index];
+        if (node.Open && node.ChildrenDecoded) {
+            for (uint32_t i = node.ChildCount; i > 0; i--) {
+                pending.push(node.FirstChild + i - 1);
+            }
+        }
+    }
+    mDisasRowsDirty = false;
+}
+
+int32_t GfxDebuggerWindow::FindDisasNode(const std::vector<const F3DGfx*>& path) const {
+    uint32_t first = 0;
+    uint32_t count = mDisasRootCount;
+    int32_t found = -1;
+    for (const F3DGfx* cmd : path) {
+        found = -1;
+        for (uint32_t i = first; i < first + count; i++) {
+            if (mDisasNodes[i].Cmd == cmd) {
+                found = static_cast<int32_t>(i);
+                break;
+            }
+        }
+        if (found < 0) {
+            return -1;
+        }
+        first = mDisasNodes[found].FirstChild;
+        count = mDisasNodes[found].ChildCount;
+    }
+    return found;
+}
+
+std::vector<const F3DGfx*> GfxDebuggerWindow::GetDisasNodePath(uint32_t index) const {
+    std::vector<const F3DGfx*> path;
+    for (int32_t i = static_cast<int32_t>(index); i >= 0; i = mDisasNodes[i].Parent) {
+        path.push_back(mDisasNodes[i].Cmd);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+void GfxDebuggerWindow::DrawDisasTree() {
+    if (mDisasRowsDirty) {
+        RebuildDisasRows();
+    }
+
+    const float indentSpacing = ImGui::GetStyle().IndentSpacing;
+    const float rowsStartY = ImGui::GetCursorPosY();
+    float rowHeight = 0.0f;
+    int32_t toggled = -1;
+    int32_t scrollToNode = -1;
+
+    // Only the rows scrolled into view are submitted; nodes are flattened into mDisasRows in display order.
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(mDisasRows.size()));
+    while (clipper.Step()) {
+        rowHeight = clipper.ItemsHeight;
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+            const uint32_t index = mDisasRows[row];
+            const DisasNode& node = mDisasNodes[index];
+
+            ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+            if (static_cast<int32_t>(index) == mSelectedDisasNode) {
+                flags |= ImGuiTreeNodeFlags_Selected;
+            }
+            if (node.Sub == nullptr) {
+                flags |= ImGuiTreeNodeFlags_Leaf;
+            }
+
+            if (node.Depth > 0) {
+                ImGui::Indent(node.Depth * indentSpacing);
+            }
+            ImGui::SetNextItemOpen(node.Open);
+            const bool open = ImGui::TreeNodeEx((const void*)(uintptr_t)(index + 1), flags, "%s", node.Label.c_str());
+            if (node.Sub != nullptr && open != node.Open) {
+                toggled = static_cast<int32_t>(index);
+            }
+
+            if (ImGui::IsItemHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Left)) {
+                mGfxDebugger->SetBreakPoint(GetDisasNodePath(index));
+            }
+
+            if (ImGui::BeginPopupContextItem(nullptr, ImGuiPopupFlags_MouseButtonRight)) {
+                if (ImGui::Selectable("Copy text")) {
+                    SDL_SetClipboardText(node.Label.c_str() + node.TextOffset);
+                }
+                if (ImGui::Selectable("Copy address")) {
+                    std::string address = fmt::format("0x{:x}", (uintptr_t)node.Cmd);
+                    SDL_SetClipboardText(address.c_str());
+                }
+                if (node.Parent >= 0 && ImGui::Selectable("Scroll to parent")) {
+                    scrollToNode = node.Parent;
+                }
+                ImGui::EndPopup();
+            }
+
+            if (node.Depth > 0) {
+                ImGui::Unindent(node.Depth * indentSpacing);
+            }
+        }
+    }
+    clipper.End();
+
+    if (scrollToNode >= 0) {
+        auto row = std::find(mDisasRows.begin(), mDisasRows.end(), static_cast<uint32_t>(scrollToNode));
+        ImGui::SetScrollY(rowsStartY + (row - mDisasRows.begin()) * rowHeight);
+    }
+    if (toggled >= 0) {
+        if (mDisasNodes[toggled].Open) {
+            mDisasNodes[toggled].Open = false;
+            mDisasRowsDirty = true;
+        } else {
+            ExpandDisasNode(static_cast<uint32_t>(toggled));
+        }
+    }
+}
+
 static const char* getTexType(Fast::TextureType type) {
     switch (type) {
 
@@ -609,8 +732,12 @@ void GfxDebuggerWindow::DrawDisas() {
     bool isNew = !bpEquals(mLastBreakPoint, dbg->GetBreakPoint());
     if (isNew) {
         mLastBreakPoint = dbg->GetBreakPoint();
+        mSelectedDisasNode = FindDisasNode(mLastBreakPoint);
         // fprintf(stderr, "NEW BREAKPOINT %s\n", bp.c_str());
     }
+    if (mDisasRoot != dlist) {
+        BuildDisasTree(dlist);
+    }
 
     std::string TO_LOAD_TEX = "GfxDebuggerWindowTextureToLoad";
 
@@ -710,10 +837,7 @@ void GfxDebuggerWindow::DrawDisas() {
     ImGui::EndChild();
 
     ImGui::BeginChild("##Disassembler", ImVec2(0.0f, 0.0f), true);
-    {
-        std::vector<const F3DGfx*> gfxPath;
-        DrawDisasNode(dlist, gfxPath);
-    }
+    DrawDisasTree();
     ImGui::EndChild();
 }
 
@@ -1,8 +1,19 @@
 #include "ship/audio/AudioPlayer.h"
+#include <algorithm>
+#include <cstring>
 #include "spdlog/spdlog.h"
 
 namespace Ship {
 
+// The ring holds a little over the old 6000-frame queue ceiling.
+static constexpr size_t gRingCapacityFrames = 8192;
+// Adaptive depth never exceeds this, leaving headroom for one late game tick.
+static constexpr int32_t gMaxTargetBuffered = static_cast<int32_t>(gRingCapacityFrames * 3 / 4);
+// Smallest step and floor used until the backend reports a device period.
+static constexpr int32_t gMinLatencyStep = 128;
+// Number of clean one-second windows required before the depth is lowered.
+static constexpr int32_t gCleanWindowsBeforeShrink = 4;
+
 AudioPlayer::~AudioPlayer() {
     SPDLOG_TRACE("destruct audio player");
 }
@@ -13,6 +24,7 @@ bool AudioPlayer::Init() {
         SPDLOG_INFO("Initializing sound matrix decoder for surround");
         mSoundMatrixDecoder = std::make_unique<SoundMatrixDecoder>(mAudioSettings.SampleRate);
     }
+    ResetRing();
     mInitialized = DoInit();
     return IsInitialized();
 }
@@ -30,7 +42,19 @@ int32_t AudioPlayer::GetSampleLength() const {
 }
 
 int32_t AudioPlayer::GetDesiredBuffered() const {
-    return mAudioSettings.DesiredBuffered;
+    return mTargetBuffered.load(std::memory_order_relaxed);
+}
+
+uint64_t AudioPlayer::GetUnderrunCount() const {
+    return mUnderrunCount.load(std::memory_order_relaxed);
+}
+
+uint64_t AudioPlayer::GetDroppedFrameCount() const {
+    return mDroppedFrameCount.load(std::memory_order_relaxed);
+}
+
+int32_t AudioPlayer::GetDevicePeriod() const {
+    return mDevicePeriod.load(std::memory_order_relaxed);
 }
 
 AudioChannelsSetting AudioPlayer::GetAudioChannels() const {
@@ -47,6 +71,7 @@ void AudioPlayer::SetSampleLength(int32_t length) {
 
 void AudioPlayer::SetDesiredBuffered(int32_t size) {
     mAudioSettings.DesiredBuffered = size;
+    mTargetBuffered.store(size, std::memory_order_relaxed);
 }
 
 bool AudioPlayer::SetAudioChannels(AudioChannelsSetting channels) {
@@ -73,6 +98,8 @@ bool AudioPlayer::SetAudioChannels(AudioChannelsSetting channels) {
         mSoundMatrixDecoder.reset();
     }
 
+    // The frame size changes with the channel count, so queued audio cannot be carried over.
+    ResetRing();
     return DoInit();
 }
 
@@ -91,6 +118,7 @@ void AudioPlayer::Play(const uint8_t* buf, size_t len) {
     if (mAudioSettings.ChannelSetting != AudioChannelsSetting::audioMatrix51) {
         // Stereo or Raw 5.1 passthrough
         DoPlay(buf, len);
+        AdaptLatency();
         return;
     }
 
@@ -104,5 +132,125 @@ void AudioPlayer::Play(const uint8_t* buf, size_t len) {
 
     // Play the audio
     DoPlay(surroundOut, surroundLen);
+    AdaptLatency();
+}
+
+int32_t AudioPlayer::Buffered() {
+    return GetQueuedFrames();
+}
+
+void AudioPlayer::DoPlay(const uint8_t* buf, size_t len) {
+    QueueFrames(buf, len);
+}
+
+size_t AudioPlayer::QueueFrames(const uint8_t* buf, size_t len) {
+    const size_t frames = len / mRing.GetBytesPerFrame();
+    const size_t written = mRing.Write(buf, frames);
+    if (written < frames) {
+        mDroppedFrameCount.fetch_add(frames - written, std::memory_order_relaxed);
+    }
+    return written;
+}
+
+size_t AudioPlayer::RenderFrames(uint8_t* out, size_t frames) {
+    if (static_cast<int32_t>(frames) > mDevicePeriod.load(std::memory_order_relaxed)) {
+        mDevicePeriod.store(static_cast<int32_t>(frames), std::memory_order_relaxed);
+    }
+
+    if (!mPrimed) {
+        const size_t target = static_cast<size_t>(mTargetBuffered.load(std::memory_order_relaxed));
+        mPrimed = mRing.Size() >= std::min(std::max(target, frames), mRing.Capacity());
+    }
+
+    size_t read = 0;
+    if (mPrimed) {
+        read = mRing.Read(out, frames);
+        if (read < frames) {
+            mUnderrunCount.fetch_add(1, std::memory_order_relaxed);
+            mPrimed = false;
+        }
+    }
+
+    const size_t bytesPerFrame = mRing.GetBytesPerFrame();
+    memset(out + read * bytesPerFrame, 0, (frames - read) * bytesPerFrame);
+    mConsumedFrames.fetch_add(frames, std::memory_order_release);
+    return read;
+}
+
+size_t AudioPlayer::DrainFrames(uint8_t* out, size_t maxFrames) {
+    const size_t read = mRing.Read(out, maxFrames);
+    mConsumedFrames.fetch_add(read, std::memory_order_release);
+    return read;
+}
+
+void AudioPlayer::ReportUnderrun() {
+    mUnderrunCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+int32_t AudioPlayer::GetQueuedFrames() const {
+    return static_cast<int32_t>(mRing.Size());
+}
+
+size_t AudioPlayer::GetBytesPerFrame() const {
+    return sizeof(int16_t) * GetNumOutputChannels();
+}
+
+void AudioPlayer::SetDevicePeriod(int32_t frames) {
+    mDevicePeriod.store(frames, std::memory_order_relaxed);
+    // Re-clamp so a larger period immediately raises the floor.
+    SetTargetBuffered(mTargetBuffered.load(std::memory_order_relaxed));
+}
+
+void AudioPlayer::ResetRing() {
+    mRing.Reset(gRingCapacityFrames, GetBytesPerFrame());
+    mPrimed = false;
+    mWindowStart = mConsumedFrames.load(std::memory_order_acquire);
+    mCleanWindows = 0;
+}
+
+void AudioPlayer::SetTargetBuffered(int32_t frames) {
+    const int32_t period = mDevicePeriod.load(std::memory_order_relaxed);
+    const int32_t floor = std::max(period * 2, gMinLatencyStep);
+    mTargetBuffered.store(std::clamp(frames, floor, gMaxTargetBuffered), std::memory_order_relaxed);
+}
+
+void AudioPlayer::AdaptLatency() {
+    if (!mAudioSettings.AdaptiveBuffering) {
+        return;
+    }
+
+    const uint64_t consumed = mConsumedFrames.load(std::memory_order_acquire);
+    const uint64_t underruns = mUnderrunCount.load(std::memory_order_relaxed);
+    const uint64_t dropped = mDroppedFrameCount.load(std::memory_order_relaxed);
+    const int32_t target = mTargetBuffered.load(std::memory_order_relaxed);
+    const int32_t step = std::max(mDevicePeriod.load(std::memory_order_relaxed), gMinLatencyStep);
+
+    // An audible gap is worse than latency, so grow as soon as one is observed.
+    if (underruns != mSeenUnderruns) {
+        mSeenUnderruns = underruns;
+        mSeenDroppedFrames = dropped;
+        mWindowStart = consumed;
+        mCleanWindows = 0;
+        SetTargetBuffered(target + step);
+        return;
+    }
+
+    if (consumed - mWindowStart < static_cast<uint64_t>(mAudioSettings.SampleRate)) {
+        return;
+    }
+    mWindowStart = consumed;
+
+    // Frames piling up past the ring means the producer is already ahead of the device.
+    if (dropped != mSeenDroppedFrames) {
+        mSeenDroppedFrames = dropped;
+        mCleanWindows = 0;
+        SetTargetBuffered(target - step);
+        return;
+    }
+
+    if (++mCleanWindows >= gCleanWindowsBeforeShrink) {
+        mCleanWindows = 0;
+        SetTargetBuffered(target - step / 2);
+    }
 }
 } // namespace Ship
@@ -0,0 +1,79 @@
+#include "ship/audio/AudioRingBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Ship {
+
+void AudioRingBuffer::Reset(size_t capacityFrames, size_t bytesPerFrame) {
+    size_t capacity = 1;
+    while (capacity < capacityFrames) {
+        capacity <<= 1;
+    }
+
+    mCapacity = capacity;
+    mMask = capacity - 1;
+    mBytesPerFrame = bytesPerFrame;
+    mData.assign(mCapacity * mBytesPerFrame, 0);
+    mWritePos.store(0, std::memory_order_relaxed);
+    mReadPos.store(0, std::memory_order_relaxed);
+}
+
+size_t AudioRingBuffer::Write(const uint8_t* buf, size_t frames) {
+    const size_t writePos = mWritePos.load(std::memory_order_relaxed);
+    const size_t readPos = mReadPos.load(std::memory_order_acquire);
+    const size_t count = std::min(frames, mCapacity - (writePos - readPos));
+    if (count == 0) {
+        return 0;
+    }
+
+    CopyIn(writePos, buf, count);
+    mWritePos.store(writePos + count, std::memory_order_release);
+    return count;
+}
+
+size_t AudioRingBuffer::Read(uint8_t* out, size_t frames) {
+    const size_t readPos = mReadPos.load(std::memory_order_relaxed);
+    const size_t writePos = mWritePos.load(std::memory_order_acquire);
+    const size_t count = std::min(frames, writePos - readPos);
+    if (count == 0) {
+        return 0;
+    }
+
+    CopyOut(readPos, out, count);
+    mReadPos.store(readPos + count, std::memory_order_release);
+    return count;
+}
+
+size_t AudioRingBuffer::Size() const {
+    const size_t readPos = mReadPos.load(std::memory_order_acquire);
+    const size_t writePos = mWritePos.load(std::memory_order_acquire);
+    return writePos - readPos;
+}
+
+size_t AudioRingBuffer::Capacity() const {
+    return mCapacity;
+}
+
+size_t AudioRingBuffer::GetBytesPerFrame() const {
+    return mBytesPerFrame;
+}
+
+void AudioRingBuffer::CopyIn(size_t pos, const uint8_t* buf, size_t frames) {
+    const size_t start = pos & mMask;
+    const size_t first = std::min(frames, mCapacity - start);
+    memcpy(mData.data() + start * mBytesPerFrame, buf, first * mBytesPerFrame);
+    if (first < frames) {
+        memcpy(mData.data(), buf + first * mBytesPerFrame, (frames - first) * mBytesPerFrame);
+    }
+}
+
+void AudioRingBuffer::CopyOut(size_t pos, uint8_t* out, size_t frames) const {
+    const size_t start = pos & mMask;
+    const size_t first = std::min(frames, mCapacity - start);
+    memcpy(out, mData.data() + start * mBytesPerFrame, first * mBytesPerFrame);
+    if (first < frames) {
+        memcpy(out + first * mBytesPerFrame, mData.data(), (frames - first) * mBytesPerFrame);
+    }
+}
+} // namespace Ship
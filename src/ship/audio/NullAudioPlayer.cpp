@@ -1,13 +1,19 @@
 #include "ship/audio/NullAudioPlayer.h"
+#include <algorithm>
 #include <spdlog/spdlog.h>
 
 namespace Ship {
 
+// Upper bound on one simulated callback, so a long stall does not turn into one huge render.
+static constexpr size_t gMaxRenderFrames = 4096;
+
 NullAudioPlayer::~NullAudioPlayer() {
     SPDLOG_TRACE("destruct Null audio player");
 }
 
 bool NullAudioPlayer::DoInit() {
+    mLastRender = std::chrono::steady_clock::now();
+    mPendingFrames = 0.0;
     return true;
 }
 
@@ -16,9 +22,45 @@ void NullAudioPlayer::DoClose() {
 }
 
 int NullAudioPlayer::Buffered() {
-    return 0;
+    RenderElapsed();
+    return GetQueuedFrames();
+}
+
+void NullAudioPlayer::SetExternalClock(bool external) {
+    mExternalClock = external;
+    mLastRender = std::chrono::steady_clock::now();
+    mPendingFrames = 0.0;
+}
+
+size_t NullAudioPlayer::Render(size_t frames) {
+    const size_t bytes = frames * GetBytesPerFrame();
+    if (mScratch.size() < bytes) {
+        mScratch.resize(bytes);
+    }
+    return RenderFrames(mScratch.data(), frames);
 }
 
 void NullAudioPlayer::DoPlay(const uint8_t* buf, size_t len) {
+    RenderElapsed();
+    QueueFrames(buf, len);
+}
+
+void NullAudioPlayer::RenderElapsed() {
+    if (mExternalClock) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    mPendingFrames += std::chrono::duration<double>(now - mLastRender).count() * GetSampleRate();
+    mLastRender = now;
+
+    // After a long stall (debugger, window drag) only catch up on the last second.
+    mPendingFrames = std::min(mPendingFrames, static_cast<double>(GetSampleRate()));
+
+    while (mPendingFrames >= 1.0) {
+        const size_t frames = std::min(static_cast<size_t>(mPendingFrames), gMaxRenderFrames);
+        Render(frames);
+        mPendingFrames -= static_cast<double>(frames);
+    }
 }
 } // namespace Ship
@@ -28,13 +28,22 @@ bool SDLAudioPlayer::DoInit() {
     mNumChannels = this->GetNumOutputChannels();
 
     const SDL_AudioSpec spec = { SDL_AUDIO_S16, mNumChannels, this->GetSampleRate() };
-    mStream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, nullptr, nullptr);
+    mStream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, AudioStreamCallback, this);
     if (mStream == nullptr) {
         SPDLOG_ERROR("SDL_OpenAudioDeviceStream error: {}", SDL_GetError());
         return false;
     }
 
-    SPDLOG_INFO("SDL Audio initialized: {} channels, {} Hz", mNumChannels, this->GetSampleRate());
+    // Let the latency floor follow the real device instead of the hardcoded defaults.
+    SDL_AudioSpec deviceSpec;
+    int deviceFrames = 0;
+    if (SDL_GetAudioDeviceFormat(SDL_GetAudioStreamDevice(mStream), &deviceSpec, &deviceFrames) && deviceFrames > 0) {
+        SetDevicePeriod(deviceFrames);
+        mScratch.resize(static_cast<size_t>(deviceFrames) * GetBytesPerFrame());
+    }
+
+    SPDLOG_INFO("SDL Audio initialized: {} channels, {} Hz, {} frame device period", mNumChannels,
+                this->GetSampleRate(), deviceFrames);
 
     SDL_ResumeAudioDevice(SDL_GetAudioStreamDevice(mStream));
     return true;
@@ -43,13 +52,25 @@ bool SDLAudioPlayer::DoInit() {
 int SDLAudioPlayer::Buffered() {
     // SDL_GetAudioStreamQueued is the SDL3 replacement for the producer-side queue size used by SDL2.
     // SDL_GetAudioStreamAvailable reports converted data for callers that read from the stream instead.
-    return mStream == nullptr ? 0 : SDL_GetAudioStreamQueued(mStream) / (sizeof(int16_t) * mNumChannels);
+    const int queued = mStream == nullptr ? 0 : SDL_GetAudioStreamQueued(mStream) / (sizeof(int16_t) * mNumChannels);
+    return GetQueuedFrames() + queued;
 }
 
-void SDLAudioPlayer::DoPlay(const uint8_t* buf, size_t len) {
-    if (Buffered() < 6000) {
-        // Don't fill the audio buffer too much in case this happens
-        SDL_PutAudioStreamData(mStream, buf, static_cast<int>(len));
+void SDLCALL SDLAudioPlayer::AudioStreamCallback(void* userdata, SDL_AudioStream* stream, int additionalAmount,
+                                                 int totalAmount) {
+    auto* player = static_cast<SDLAudioPlayer*>(userdata);
+    if (additionalAmount <= 0) {
+        return;
     }
+
+    const size_t bytesPerFrame = player->GetBytesPerFrame();
+    const size_t frames = (static_cast<size_t>(additionalAmount) + bytesPerFrame - 1) / bytesPerFrame;
+    if (player->mScratch.size() < frames * bytesPerFrame) {
+        // Only happens if SDL asks for more than the reported device period.
+        player->mScratch.resize(frames * bytesPerFrame);
+    }
+
+    player->RenderFrames(player->mScratch.data(), frames);
+    SDL_PutAudioStreamData(stream, player->mScratch.data(), static_cast<int>(frames * bytesPerFrame));
 }
 } // namespace Ship
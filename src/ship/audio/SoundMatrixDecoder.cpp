@@ -1,7 +1,119 @@
 #include "ship/audio/SoundMatrixDecoder.h"
 
+#include <algorithm>
+#include <iterator>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SOUND_MATRIX_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define SOUND_MATRIX_NEON
+#endif
+
 namespace Ship {
 
+namespace {
+// Minimal 4-lane float vector for the single-precision filter banks. Falls back
+// to plain arrays (which compilers still auto-vectorize) when neither SSE2 nor
+// NEON is available.
+struct Float4 {
+#if defined(SOUND_MATRIX_SSE2)
+    __m128 V;
+
+    static Float4 Load(const float* ptr) {
+        return { _mm_load_ps(ptr) };
+    }
+    static Float4 Splat(float value) {
+        return { _mm_set1_ps(value) };
+    }
+    static Float4 Set(float a, float b, float c, float d) {
+        return { _mm_setr_ps(a, b, c, d) };
+    }
+    void Store(float* ptr) const {
+        _mm_store_ps(ptr, V);
+    }
+    friend Float4 operator+(Float4 a, Float4 b) {
+        return { _mm_add_ps(a.V, b.V) };
+    }
+    friend Float4 operator-(Float4 a, Float4 b) {
+        return { _mm_sub_ps(a.V, b.V) };
+    }
+    friend Float4 operator*(Float4 a, Float4 b) {
+        return { _mm_mul_ps(a.V, b.V) };
+    }
+#elif defined(SOUND_MATRIX_NEON)
+    float32x4_t V;
+
+    static Float4 Load(const float* ptr) {
+        return { vld1q_f32(ptr) };
+    }
+    static Float4 Splat(float value) {
+        return { vdupq_n_f32(value) };
+    }
+    static Float4 Set(float a, float b, float c, float d) {
+        alignas(16) const float lanes[4] = { a, b, c, d };
+        return { vld1q_f32(lanes) };
+    }
+    void Store(float* ptr) const {
+        vst1q_f32(ptr, V);
+    }
+    friend Float4 operator+(Float4 a, Float4 b) {
+        return { vaddq_f32(a.V, b.V) };
+    }
+    friend Float4 operator-(Float4 a, Float4 b) {
+        return { vsubq_f32(a.V, b.V) };
+    }
+    friend Float4 operator*(Float4 a, Float4 b) {
+        return { vmulq_f32(a.V, b.V) };
+    }
+#else
+    float V[4];
+
+    static Float4 Load(const float* ptr) {
+        return { { ptr[0], ptr[1], ptr[2], ptr[3] } };
+    }
+    static Float4 Splat(float value) {
+        return { { value, value, value, value } };
+    }
+    static Float4 Set(float a, float b, float c, float d) {
+        return { { a, b, c, d } };
+    }
+    void Store(float* ptr) const {
+        for (int i = 0; i < 4; i++) {
+            ptr[i] = V[i];
+        }
+    }
+    friend Float4 operator+(Float4 a, Float4 b) {
+        return { { a.V[0] + b.V[0], a.V[1] + b.V[1], a.V[2] + b.V[2], a.V[3] + b.V[3] } };
+    }
+    friend Float4 operator-(Float4 a, Float4 b) {
+        return { { a.V[0] - b.V[0], a.V[1] - b.V[1], a.V[2] - b.V[2], a.V[3] - b.V[3] } };
+    }
+    friend Float4 operator*(Float4 a, Float4 b) {
+        return { { a.V[0] * b.V[0], a.V[1] * b.V[1], a.V[2] * b.V[2], a.V[3] * b.V[3] } };
+    }
+#endif
+};
+
+// Runs one transposed direct form II section on all four lanes.
+inline Float4 ProcessSection(Float4 in, float* s1, float* s2, Float4 b0, Float4 b1, Float4 b2, Float4 a1,
+                             Float4 a2) {
+    const Float4 out = b0 * in + Float4::Load(s1);
+    (b1 * in - a1 * out + Float4::Load(s2)).Store(s1);
+    (b2 * in - a2 * out).Store(s2);
+    return out;
+}
+
+// Scalar equivalent of ProcessSection() for a single lane.
+inline float ProcessSection(float in, float& s1, float& s2, float b0, float b1, float b2, float a1, float a2) {
+    const float out = b0 * in + s1;
+    s1 = b1 * in - a1 * out + s2;
+    s2 = b2 * in - a2 * out;
+    return out;
+}
+} // namespace
+
 // Standard matrix decoding gains derived from psychoacoustic principles
 namespace Gains {
 constexpr float gCenter = 0.7071067811865476f * 0.5f; // -3dB (1/sqrt(2)) * 0.5
@@ -15,7 +127,7 @@ namespace Timing {
 constexpr int gSurroundDelayMs = 10; // ITU-R BS.775 recommends 10-25ms
 }
 
-SoundMatrixDecoder::SoundMatrixDecoder(int32_t sampleRate) {
+SoundMatrixDecoder::SoundMatrixDecoder(int32_t sampleRate, Precision precision) : mPrecision(precision) {
     // Compute delay length from sample rate
     mDelayLength = (sampleRate * Timing::gSurroundDelayMs) / 1000;
     if (mDelayLength > gMaxDelay) {
@@ -31,6 +143,15 @@ SoundMatrixDecoder::SoundMatrixDecoder(int32_t sampleRate) {
     mCoefSurroundHP = DesignHighPass(100.0, sampleRate); // Surround channels high-passed
     mCoefSubLP = DesignLowPass(120.0, sampleRate);       // LFE low-pass
 
+    // Same crossovers as second-order sections for the float path
+    const BiquadSection surroundHP = DesignSection(100.0, sampleRate, true);
+    for (int lane = 0; lane < gLanes; lane++) {
+        SetLane(mCoefSurroundBank, lane, surroundHP);
+    }
+    SetLane(mCoefFrontBank, 0, DesignSection(70.0, sampleRate, true));
+    SetLane(mCoefFrontBank, 1, DesignSection(120.0, sampleRate, false));
+    mCenterLowPassSection = DesignSection(20000.0, sampleRate, false);
+
     // Initialize phase chains with sample rate
     mPhaseLeftMain = {};
     mPhaseLeftCross = {};
@@ -40,6 +161,14 @@ SoundMatrixDecoder::SoundMatrixDecoder(int32_t sampleRate) {
     PrepareAllPass(mPhaseLeftCross, sampleRate);
     PrepareAllPass(mPhaseRightMain, sampleRate);
     PrepareAllPass(mPhaseRightCross, sampleRate);
+    mPhaseBank = {};
+    const AllPassChain* chains[gLanes] = { &mPhaseLeftMain, &mPhaseLeftCross, &mPhaseRightMain, &mPhaseRightCross };
+    for (int lane = 0; lane < gLanes; lane++) {
+        mPhaseBank.Freq[lane] = chains[lane]->Freq;
+        mPhaseBank.FreqMin[lane] = chains[lane]->FreqMin;
+        mPhaseBank.FreqMax[lane] = chains[lane]->FreqMax;
+        mPhaseBank.SweepRate[lane] = chains[lane]->SweepRate;
+    }
 
     // Reset filter states
     ResetState();
@@ -54,6 +183,10 @@ void SoundMatrixDecoder::ResetState() {
     mSurrRightMainHP = {};
     mSurrRightCrossHP = {};
     mSubLowPass = {};
+    mSurroundBank = {};
+    mFrontBank = {};
+    std::fill(std::begin(mCenterLowPassSection.S1), std::end(mCenterLowPassSection.S1), 0.0f);
+    std::fill(std::begin(mCenterLowPassSection.S2), std::end(mCenterLowPassSection.S2), 0.0f);
 
     // Reset delay lines
     mDelaySurrLeft = {};
@@ -62,6 +195,10 @@ void SoundMatrixDecoder::ResetState() {
     mDelaySurrRight.Length = mDelayLength;
 }
 
+SoundMatrixDecoder::Precision SoundMatrixDecoder::GetPrecision() const {
+    return mPrecision;
+}
+
 SoundMatrixDecoder::FilterCoefficients SoundMatrixDecoder::DesignLowPass(double frequency, int32_t sampleRate) {
     FilterCoefficients coef = {};
 
@@ -137,6 +274,41 @@ SoundMatrixDecoder::FilterCoefficients SoundMatrixDecoder::DesignHighPass(double
     return coef;
 }
 
+SoundMatrixDecoder::BiquadSection SoundMatrixDecoder::DesignSection(double frequency, int32_t sampleRate,
+                                                                   bool highPass) {
+    BiquadSection section = {};
+
+    // Match DesignLowPass()'s clamp so both paths realize the same response
+    double maxFreq = sampleRate * 0.475;
+    if (!highPass && frequency > maxFreq) {
+        frequency = maxFreq;
+    }
+
+    // Bilinear-transformed 2nd-order Butterworth with the same prewarping as the
+    // 4th-order design; its square is exactly the Linkwitz-Riley response.
+    double w = std::tan(M_PI * frequency / sampleRate);
+    double w2 = w * w;
+    double rt2w = std::sqrt(2.0) * w;
+    double norm = 1.0 + rt2w + w2;
+
+    double b0 = highPass ? 1.0 / norm : w2 / norm;
+    double b1 = highPass ? -2.0 * b0 : 2.0 * b0;
+    section.B0 = static_cast<float>(b0);
+    section.B1 = static_cast<float>(b1);
+    section.B2 = static_cast<float>(b0);
+    section.A1 = static_cast<float>(2.0 * (w2 - 1.0) / norm);
+    section.A2 = static_cast<float>((1.0 - rt2w + w2) / norm);
+    return section;
+}
+
+void SoundMatrixDecoder::SetLane(BiquadBankCoefficients& coef, int lane, const BiquadSection& section) {
+    coef.B0[lane] = section.B0;
+    coef.B1[lane] = section.B1;
+    coef.B2[lane] = section.B2;
+    coef.A1[lane] = section.A1;
+    coef.A2[lane] = section.A2;
+}
+
 float SoundMatrixDecoder::ProcessFilter(float sample, BiquadCascade& state, const FilterCoefficients& coef) {
     double in = sample;
     double out = coef.A[0] * in + coef.A[1] * state.X[0] + coef.A[2] * state.X[1] + coef.A[3] * state.X[2] +
@@ -230,6 +402,16 @@ std::tuple<const uint8_t*, int> SoundMatrixDecoder::Process(const uint8_t* buf,
         mSurroundBuffer.resize(samplesNeeded);
     }
 
+    if (mPrecision == Precision::Float) {
+        ProcessFloat(stereoInput, samplePairs);
+    } else {
+        ProcessDouble(stereoInput, samplePairs);
+    }
+
+    return { reinterpret_cast<const uint8_t*>(mSurroundBuffer.data()), samplePairs * 6 * sizeof(int16_t) };
+}
+
+void SoundMatrixDecoder::ProcessDouble(const int16_t* stereoInput, int samplePairs) {
     for (int i = 0; i < samplePairs; ++i) {
         float inL = static_cast<float>(stereoInput[i * 2]);
         float inR = static_cast<float>(stereoInput[i * 2 + 1]);
@@ -277,8 +459,110 @@ std::tuple<const uint8_t*, int> SoundMatrixDecoder::Process(const uint8_t* buf,
         mSurroundBuffer[i * 6 + 4] = Saturate(surrL);
         mSurroundBuffer[i * 6 + 5] = Saturate(surrR);
     }
+}
 
-    return { reinterpret_cast<const uint8_t*>(mSurroundBuffer.data()), samplePairs * 6 * sizeof(int16_t) };
+void SoundMatrixDecoder::PrepareAllPassBlock(int count) {
+    // The sweep does not depend on the signal, so a whole block of first-order
+    // coefficients can be produced up front and streamed through the filters.
+    for (int lane = 0; lane < gLanes; lane++) {
+        double freq = mPhaseBank.Freq[lane];
+        double sweepRate = mPhaseBank.SweepRate[lane];
+        const double freqMin = mPhaseBank.FreqMin[lane];
+        const double freqMax = mPhaseBank.FreqMax[lane];
+
+        for (int i = 0; i < count; i++) {
+            mAllPassCoef[i][lane] = static_cast<float>((1.0 - freq) / (1.0 + freq));
+
+            freq *= sweepRate;
+            if (freq > freqMax) {
+                sweepRate = 1.0 / mAllPassBaseRate;
+            } else if (freq < freqMin) {
+                sweepRate = mAllPassBaseRate;
+            }
+        }
+
+        mPhaseBank.Freq[lane] = freq;
+        mPhaseBank.SweepRate[lane] = sweepRate;
+    }
+}
+
+void SoundMatrixDecoder::ProcessFloat(const int16_t* stereoInput, int samplePairs) {
+    const BiquadBankCoefficients& sc = mCoefSurroundBank;
+    const BiquadBankCoefficients& fc = mCoefFrontBank;
+    const Float4 surrB0 = Float4::Load(sc.B0);
+    const Float4 surrB1 = Float4::Load(sc.B1);
+    const Float4 surrB2 = Float4::Load(sc.B2);
+    const Float4 surrA1 = Float4::Load(sc.A1);
+    const Float4 surrA2 = Float4::Load(sc.A2);
+    const Float4 frontB0 = Float4::Load(fc.B0);
+    const Float4 frontB1 = Float4::Load(fc.B1);
+    const Float4 frontB2 = Float4::Load(fc.B2);
+    const Float4 frontA1 = Float4::Load(fc.A1);
+    const Float4 frontA2 = Float4::Load(fc.A2);
+
+    // Lane gains and all-pass polarity for {L main, L cross, R main, R cross}
+    const Float4 surroundGain =
+        Float4::Set(Gains::gSurroundPrimary, Gains::gSurroundSecondary, Gains::gSurroundPrimary,
+                    Gains::gSurroundSecondary);
+    const Float4 phaseSign = Float4::Set(-1.0f, 1.0f, 1.0f, -1.0f);
+
+    AllPassBank& ap = mPhaseBank;
+    BiquadBankState& surr = mSurroundBank;
+    BiquadBankState& front = mFrontBank;
+    int16_t* out = mSurroundBuffer.data();
+
+    for (int blockStart = 0; blockStart < samplePairs; blockStart += gBlockSize) {
+        const int count = std::min(gBlockSize, samplePairs - blockStart);
+        PrepareAllPassBlock(count);
+
+        for (int n = 0; n < count; ++n) {
+            const int i = blockStart + n;
+            float inL = static_cast<float>(stereoInput[i * 2]);
+            float inR = static_cast<float>(stereoInput[i * 2 + 1]);
+            float mid = (inL + inR) * Gains::gCenter;
+
+            // Surround high-pass: two Butterworth sections per lane
+            Float4 s = Float4::Set(inL, inR, inR, inL) * surroundGain;
+            s = ProcessSection(s, surr.S1[0], surr.S2[0], surrB0, surrB1, surrB2, surrA1, surrA2);
+            s = ProcessSection(s, surr.S1[1], surr.S2[1], surrB0, surrB1, surrB2, surrA1, surrA2);
+
+            // Four cascaded first-order all-pass sections per lane
+            const Float4 c = Float4::Load(mAllPassCoef[n]);
+            Float4 x = s;
+            for (int stage = 0; stage < 4; stage++) {
+                Float4 y = c * (Float4::Load(ap.YHist[stage]) + x) - Float4::Load(ap.XHist[stage]);
+                x.Store(ap.XHist[stage]);
+                y.Store(ap.YHist[stage]);
+                x = y;
+            }
+            alignas(16) float phase[gLanes];
+            (x * phaseSign).Store(phase);
+
+            // Center high-pass and LFE low-pass share the mid input
+            Float4 f = Float4::Splat(mid);
+            f = ProcessSection(f, front.S1[0], front.S2[0], frontB0, frontB1, frontB2, frontA1, frontA2);
+            f = ProcessSection(f, front.S1[1], front.S2[1], frontB0, frontB1, frontB2, frontA1, frontA2);
+            alignas(16) float frontOut[gLanes];
+            f.Store(frontOut);
+
+            // Center low-pass depends on this sample's high-pass output, so it runs scalar
+            BiquadSection& lp = mCenterLowPassSection;
+            float ctr = frontOut[0];
+            ctr = ProcessSection(ctr, lp.S1[0], lp.S2[0], lp.B0, lp.B1, lp.B2, lp.A1, lp.A2);
+            ctr = ProcessSection(ctr, lp.S1[1], lp.S2[1], lp.B0, lp.B1, lp.B2, lp.A1, lp.A2);
+
+            float surrL = ProcessDelay(phase[0] + phase[1], mDelaySurrLeft);
+            float surrR = ProcessDelay(phase[2] + phase[3], mDelaySurrRight);
+
+            // Output: FL, FR, C, LFE, SL, SR
+            out[i * 6 + 0] = Saturate(inL * Gains::gFront);
+            out[i * 6 + 1] = Saturate(inR * Gains::gFront);
+            out[i * 6 + 2] = Saturate(ctr);
+            out[i * 6 + 3] = Saturate(frontOut[1]);
+            out[i * 6 + 4] = Saturate(surrL);
+            out[i * 6 + 5] = Saturate(surrR);
+        }
+    }
 }
 
 } // namespace Ship
@@ -67,6 +67,12 @@ bool WasapiAudioPlayer::SetupStream() {
         ThrowIfFailed(mClient->GetBufferSize(&mBufferFrameCount));
         ThrowIfFailed(mClient->GetService(IID_PPV_ARGS(&mRenderClient)));
 
+        // The shared-mode engine period is the smallest useful buffering step.
+        REFERENCE_TIME defaultPeriod = 0;
+        if (SUCCEEDED(mClient->GetDevicePeriod(&defaultPeriod, nullptr)) && defaultPeriod > 0) {
+            SetDevicePeriod(static_cast<int32_t>(defaultPeriod * this->GetSampleRate() / 10000000));
+        }
+
         mStarted = false;
         mInitialized = true;
     } catch (const HResultException& e) {
@@ -108,49 +114,56 @@ int WasapiAudioPlayer::Buffered() {
     std::lock_guard<std::mutex> lock(mMutex);
     if (!mInitialized) {
         if (!SetupStream()) {
-            return 0;
+            return GetQueuedFrames();
         }
     }
     try {
         UINT32 padding;
         ThrowIfFailed(mClient->GetCurrentPadding(&padding));
-        return padding;
+        return GetQueuedFrames() + padding;
     } catch (const HResultException& e) {
         SPDLOG_ERROR("WasapiAudioPlayer::Buffered failed: {}", e.what());
-        return 0;
+        return GetQueuedFrames();
     }
 }
 
 void WasapiAudioPlayer::DoPlay(const uint8_t* buf, size_t len) {
     std::lock_guard<std::mutex> lock(mMutex);
+    QueueFrames(buf, len);
     if (!mInitialized) {
         if (!SetupStream()) {
             return;
         }
     }
     try {
-        UINT32 frames = len / (mNumChannels * sizeof(int16_t));
-        UINT32 padding;
-        ThrowIfFailed(mClient->GetCurrentPadding(&padding));
+        FeedDevice();
+    } catch (const HResultException& e) { SPDLOG_ERROR("WasapiAudioPlayer::DoPlay failed: {}", e.what()); }
+}
 
-        UINT32 available = mBufferFrameCount - padding;
-        if (available < frames) {
-            frames = available;
-        }
-        if (available == 0) {
-            return;
-        }
+void WasapiAudioPlayer::FeedDevice() {
+    UINT32 padding;
+    ThrowIfFailed(mClient->GetCurrentPadding(&padding));
+    if (mStarted && padding == 0) {
+        // The engine consumed everything we gave it before we came back with more.
+        ReportUnderrun();
+    }
 
-        BYTE* data;
-        ThrowIfFailed(mRenderClient->GetBuffer(frames, &data));
-        memcpy(data, buf, frames * mNumChannels * sizeof(int16_t));
-        ThrowIfFailed(mRenderClient->ReleaseBuffer(frames, 0));
+    const UINT32 available = mBufferFrameCount - padding;
+    const UINT32 queued = static_cast<UINT32>(GetQueuedFrames());
+    const UINT32 frames = available < queued ? available : queued;
+    if (frames == 0) {
+        return;
+    }
 
-        if (!mStarted && padding + frames > 1500) {
-            mStarted = true;
-            ThrowIfFailed(mClient->Start());
-        }
-    } catch (const HResultException& e) { SPDLOG_ERROR("WasapiAudioPlayer::DoPlay failed: {}", e.what()); }
+    BYTE* data;
+    ThrowIfFailed(mRenderClient->GetBuffer(frames, &data));
+    const UINT32 written = static_cast<UINT32>(DrainFrames(data, frames));
+    ThrowIfFailed(mRenderClient->ReleaseBuffer(written, 0));
+
+    if (!mStarted && static_cast<int32_t>(padding + written) >= GetDesiredBuffered()) {
+        mStarted = true;
+        ThrowIfFailed(mClient->Start());
+    }
 }
 
 HRESULT STDMETHODCALLTYPE WasapiAudioPlayer::OnDeviceStateChanged(LPCWSTR pwstrDeviceId, DWORD dwNewState) {
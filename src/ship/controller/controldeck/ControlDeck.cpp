@@ -6,6 +6,7 @@
 #include "ship/utils/StringHelper.h"
 #include "ship/config/ConsoleVariable.h"
 #include <imgui.h>
+#include <algorithm>
 #include <stdexcept>
 #include "ship/controller/controldevice/controller/mapping/mouse/WheelHandler.h"
 
@@ -108,6 +109,111 @@ bool ControlDeck::MouseGameInputBlocked() {
     return AllGameInputBlocked() || (window->ID != GetWindow()->GetGui()->GetMainGameWindowID());
 }
 
+static float AxisButtonThreshold(int32_t axis, int32_t stickPercentage, int32_t triggerPercentage) {
+    int32_t percentage = 25;
+    if (axis == SDL_GAMEPAD_AXIS_LEFTX || axis == SDL_GAMEPAD_AXIS_LEFTY || axis == SDL_GAMEPAD_AXIS_RIGHTX ||
+        axis == SDL_GAMEPAD_AXIS_RIGHTY) {
+        percentage = stickPercentage;
+    } else if (axis == SDL_GAMEPAD_AXIS_LEFT_TRIGGER || axis == SDL_GAMEPAD_AXIS_RIGHT_TRIGGER) {
+        percentage = triggerPercentage;
+    }
+    return SDL_JOYSTICK_AXIS_MAX * (percentage / 100.0f);
+}
+
+void ControlDeck::UpdateInputSnapshot() {
+    mInputSnapshotFrame = ImGui::GetCurrentContext() != nullptr ? ImGui::GetFrameCount() : -1;
+
+    mInputSnapshot.GamepadBlocked = GamepadGameInputBlocked();
+    mInputSnapshot.KeyboardBlocked = KeyboardGameInputBlocked();
+    mInputSnapshot.MouseBlocked = MouseGameInputBlocked();
+
+    auto& ports = mInputSnapshot.Ports;
+    ports.assign(mPorts.size(), PortInputSnapshot());
+
+    // Only pay for sensor reads on ports that actually map the gyro.
+    uint64_t wantsGyro = 0;
+    for (size_t i = 0; i < mPorts.size() && i < 64; i++) {
+        auto controller = mPorts[i]->GetConnectedController();
+        if (controller != nullptr &&
+            controller->GetGyro()->HasMappingForPhysicalDeviceType(PhysicalDeviceType::SDLGamepad)) {
+            wantsGyro |= 1ULL << i;
+        }
+    }
+
+    // Read each gamepad once, then fold it into every port that is not ignoring it.
+    for (const auto& [instanceId, gamepad] : mConnectedPhysicalDeviceManager->GetConnectedSDLGamepads()) {
+        uint64_t buttons = 0;
+        for (int32_t button = 0; button < SDL_GAMEPAD_BUTTON_COUNT; button++) {
+            if (SDL_GetGamepadButton(gamepad, static_cast<SDL_GamepadButton>(button))) {
+                buttons |= 1ULL << button;
+            }
+        }
+
+        int16_t axes[SDL_GAMEPAD_AXIS_COUNT];
+        for (int32_t axis = 0; axis < SDL_GAMEPAD_AXIS_COUNT; axis++) {
+            axes[axis] = SDL_GetGamepadAxis(gamepad, static_cast<SDL_GamepadAxis>(axis));
+        }
+
+        const bool hasGyro = wantsGyro != 0 && SDL_GamepadHasSensor(gamepad, SDL_SENSOR_GYRO);
+        bool gyroRead = false;
+        float gyro[3] = {};
+
+        for (size_t i = 0; i < ports.size(); i++) {
+            if (mConnectedPhysicalDeviceManager->PortIsIgnoringInstanceId(static_cast<uint8_t>(i), instanceId)) {
+                continue;
+            }
+
+            auto& port = ports[i];
+            port.Buttons |= buttons;
+            for (int32_t axis = 0; axis < SDL_GAMEPAD_AXIS_COUNT; axis++) {
+                port.AxisMax[axis] = std::max(port.AxisMax[axis], axes[axis]);
+                port.AxisMin[axis] = std::min(port.AxisMin[axis], axes[axis]);
+            }
+            port.GamepadCount++;
+
+            // just use gyro on the first gyro supported device we find
+            if (hasGyro && !port.HasGyro && i < 64 && (wantsGyro & (1ULL << i))) {
+                if (!gyroRead) {
+                    SDL_SetGamepadSensorEnabled(gamepad, SDL_SENSOR_GYRO, true);
+                    SDL_GetGamepadSensorData(gamepad, SDL_SENSOR_GYRO, gyro, 3);
+                    gyroRead = true;
+                }
+                port.HasGyro = true;
+                std::copy(gyro, gyro + 3, port.Gyro);
+            }
+        }
+    }
+
+    if (mConnectedPhysicalDeviceManager->GetConnectedSDLGamepads().empty()) {
+        return;
+    }
+
+    const int32_t stickPercentage = mGlobalSDLDeviceSettings->GetStickAxisThresholdPercentage();
+    const int32_t triggerPercentage = mGlobalSDLDeviceSettings->GetTriggerAxisThresholdPercentage();
+    float thresholds[SDL_GAMEPAD_AXIS_COUNT];
+    for (int32_t axis = 0; axis < SDL_GAMEPAD_AXIS_COUNT; axis++) {
+        thresholds[axis] = AxisButtonThreshold(axis, stickPercentage, triggerPercentage);
+    }
+
+    for (auto& port : ports) {
+        for (int32_t axis = 0; axis < SDL_GAMEPAD_AXIS_COUNT; axis++) {
+            if (port.AxisMax[axis] > thresholds[axis]) {
+                port.AxisDirections |= PortInputSnapshot::AxisDirectionBit(axis, true);
+            }
+            if (port.AxisMin[axis] < -thresholds[axis]) {
+                port.AxisDirections |= PortInputSnapshot::AxisDirectionBit(axis, false);
+            }
+        }
+    }
+}
+
+const InputSnapshot& ControlDeck::GetInputSnapshot() {
+    if (ImGui::GetCurrentContext() == nullptr || mInputSnapshotFrame != ImGui::GetFrameCount()) {
+        UpdateInputSnapshot();
+    }
+    return mInputSnapshot;
+}
+
 std::shared_ptr<Controller> ControlDeck::GetControllerByPort(uint8_t port) {
     return mPorts[port]->GetConnectedController();
 }
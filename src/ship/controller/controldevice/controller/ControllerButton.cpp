@@ -4,6 +4,8 @@
 
 #include "ship/controller/controldevice/controller/mapping/keyboard/KeyboardKeyToButtonMapping.h"
 #include "ship/controller/controldevice/controller/mapping/mouse/MouseButtonToButtonMapping.h"
+#include "ship/controller/controldevice/controller/mapping/sdl/SDLButtonToButtonMapping.h"
+#include "ship/controller/controldevice/controller/mapping/sdl/SDLAxisDirectionToButtonMapping.h"
 
 #include "ship/config/ConsoleVariable.h"
 #include "ship/utils/StringHelper.h"
@@ -46,16 +48,19 @@ std::shared_ptr<ControllerButtonMapping> ControllerButton::GetButtonMappingById(
 
 void ControllerButton::AddButtonMapping(std::shared_ptr<ControllerButtonMapping> mapping) {
     mButtonMappings[mapping->GetButtonMappingId()] = mapping;
+    RebuildMappingTable();
 }
 
 void ControllerButton::ClearButtonMappingId(std::string id) {
     mButtonMappings.erase(id);
+    RebuildMappingTable();
     SaveButtonMappingIdsToConfig();
 }
 
 void ControllerButton::ClearButtonMapping(std::string id) {
     mButtonMappings[id]->EraseFromConfig();
     mButtonMappings.erase(id);
+    RebuildMappingTable();
     SaveButtonMappingIdsToConfig();
 }
 
@@ -96,6 +101,7 @@ void ControllerButton::SaveButtonMappingIdsToConfig() {
 
 void ControllerButton::ReloadAllMappingsFromConfig() {
     mButtonMappings.clear();
+    RebuildMappingTable();
 
     // todo: this efficently (when we build out cvar array support?)
     // i don't expect it to really be a problem with the small number of mappings we have
@@ -117,6 +123,7 @@ void ControllerButton::ClearAllButtonMappings() {
         mapping->EraseFromConfig();
     }
     mButtonMappings.clear();
+    RebuildMappingTable();
     SaveButtonMappingIdsToConfig();
 }
 
@@ -135,11 +142,52 @@ void ControllerButton::ClearAllButtonMappingsForDeviceType(PhysicalDeviceType ph
             mButtonMappings.erase(it);
         }
     }
+    RebuildMappingTable();
     SaveButtonMappingIdsToConfig();
 }
 
-void ControllerButton::UpdatePad(CONTROLLERBUTTONS_T& padButtons) {
+void ControllerButton::RebuildMappingTable() {
+    mSDLButtonRules.clear();
+    mOtherButtonMappings.clear();
+
     for (const auto& [id, mapping] : mButtonMappings) {
+        uint64_t buttons = 0;
+        uint64_t axisDirections = 0;
+        if (auto sdlButton = std::dynamic_pointer_cast<SDLButtonToButtonMapping>(mapping)) {
+            buttons = sdlButton->GetSDLButtonMask();
+        } else if (auto sdlAxis = std::dynamic_pointer_cast<SDLAxisDirectionToButtonMapping>(mapping)) {
+            axisDirections = sdlAxis->GetSDLAxisDirectionMask();
+        } else {
+            mOtherButtonMappings.push_back(mapping.get());
+            continue;
+        }
+
+        // every SDL source that sets the same bitmask folds into one rule
+        auto rule = std::find_if(mSDLButtonRules.begin(), mSDLButtonRules.end(),
+                                 [&mapping](const SDLButtonRule& r) { return r.Bitmask == mapping->GetBitmask(); });
+        if (rule == mSDLButtonRules.end()) {
+            mSDLButtonRules.push_back({ buttons, axisDirections, mapping->GetBitmask() });
+        } else {
+            rule->Buttons |= buttons;
+            rule->AxisDirections |= axisDirections;
+        }
+    }
+}
+
+void ControllerButton::UpdatePad(CONTROLLERBUTTONS_T& padButtons) {
+    if (!mSDLButtonRules.empty()) {
+        const auto& snapshot = mControlDeck->GetInputSnapshot();
+        if (!snapshot.GamepadBlocked) {
+            const auto& port = snapshot.GetPort(mPortIndex);
+            for (const auto& rule : mSDLButtonRules) {
+                if ((port.Buttons & rule.Buttons) | (port.AxisDirections & rule.AxisDirections)) {
+                    padButtons |= rule.Bitmask;
+                }
+            }
+        }
+    }
+
+    for (auto mapping : mOtherButtonMappings) {
         mapping->UpdatePad(padButtons);
     }
 }
@@ -19,7 +19,7 @@ KeyboardKeyToAxisDirectionMapping::KeyboardKeyToAxisDirectionMapping(uint8_t por
 }
 
 float KeyboardKeyToAxisDirectionMapping::GetNormalizedAxisDirectionValue() {
-    if (mControlDeck->KeyboardGameInputBlocked()) {
+    if (mControlDeck->GetInputSnapshot().KeyboardBlocked) {
         return 0.0f;
     }
 
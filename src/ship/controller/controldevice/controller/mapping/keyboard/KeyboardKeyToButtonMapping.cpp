@@ -17,7 +17,7 @@ KeyboardKeyToButtonMapping::KeyboardKeyToButtonMapping(uint8_t portIndex, CONTRO
 }
 
 void KeyboardKeyToButtonMapping::UpdatePad(CONTROLLERBUTTONS_T& padButtons) {
-    if (mControlDeck->KeyboardGameInputBlocked()) {
+    if (mControlDeck->GetInputSnapshot().KeyboardBlocked) {
         return;
     }
 
@@ -17,7 +17,7 @@ MouseButtonToAxisDirectionMapping::MouseButtonToAxisDirectionMapping(uint8_t por
 }
 
 float MouseButtonToAxisDirectionMapping::GetNormalizedAxisDirectionValue() {
-    if (mControlDeck->MouseGameInputBlocked()) {
+    if (mControlDeck->GetInputSnapshot().MouseBlocked) {
         return 0.0f;
     }
 
@@ -15,7 +15,7 @@ MouseButtonToButtonMapping::MouseButtonToButtonMapping(uint8_t portIndex, CONTRO
 }
 
 void MouseButtonToButtonMapping::UpdatePad(CONTROLLERBUTTONS_T& padButtons) {
-    if (mControlDeck->MouseGameInputBlocked()) {
+    if (mControlDeck->GetInputSnapshot().MouseBlocked) {
         return;
     }
 
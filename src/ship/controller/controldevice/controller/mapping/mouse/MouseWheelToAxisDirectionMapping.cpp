@@ -19,7 +19,7 @@ MouseWheelToAxisDirectionMapping::MouseWheelToAxisDirectionMapping(uint8_t portI
 }
 
 float MouseWheelToAxisDirectionMapping::GetNormalizedAxisDirectionValue() {
-    if (mControlDeck->MouseGameInputBlocked()) {
+    if (mControlDeck->GetInputSnapshot().MouseBlocked) {
         return 0.0f;
     }
 
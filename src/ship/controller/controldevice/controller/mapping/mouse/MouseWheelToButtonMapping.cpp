@@ -17,7 +17,7 @@ MouseWheelToButtonMapping::MouseWheelToButtonMapping(uint8_t portIndex, CONTROLL
 }
 
 void MouseWheelToButtonMapping::UpdatePad(CONTROLLERBUTTONS_T& padButtons) {
-    if (mControlDeck->MouseGameInputBlocked()) {
+    if (mControlDeck->GetInputSnapshot().MouseBlocked) {
         return;
     }
 
@@ -19,31 +19,19 @@ SDLAxisDirectionToAxisDirectionMapping::SDLAxisDirectionToAxisDirectionMapping(
 }
 
 float SDLAxisDirectionToAxisDirectionMapping::GetNormalizedAxisDirectionValue() {
-    if (mControlDeck->GamepadGameInputBlocked()) {
+    const auto& snapshot = mControlDeck->GetInputSnapshot();
+    if (snapshot.GamepadBlocked) {
         return 0.0f;
     }
 
-    // todo: i don't like making a vector here, not sure what a better solution is
-    std::vector<float> normalizedValues = {};
-    for (const auto& [instanceId, gamepad] :
-         mControlDeck->GetConnectedPhysicalDeviceManager()->GetConnectedSDLGamepadsForPort(mPortIndex)) {
-        const auto axisValue = SDL_GetGamepadAxis(gamepad, mControllerAxis);
+    // the snapshot keeps the furthest value in each direction across the port's gamepads,
+    // both clamped through zero, so this is the largest deflection in the mapped direction
+    const auto& port = snapshot.GetPort(mPortIndex);
+    const float axisValue = mAxisDirection == POSITIVE ? port.AxisMax[mControllerAxis] : port.AxisMin[mControllerAxis];
 
-        if ((mAxisDirection == POSITIVE && axisValue < 0) || (mAxisDirection == NEGATIVE && axisValue > 0)) {
-            normalizedValues.push_back(0.0f);
-            continue;
-        }
-
-        // scale {-32768 ... +32767} to {-MAX_AXIS_RANGE ... +MAX_AXIS_RANGE}
-        // and use the absolute value of it
-        normalizedValues.push_back(fabs(axisValue * MAX_AXIS_RANGE / MAX_SDL_RANGE));
-    }
-
-    if (normalizedValues.size() == 0) {
-        return 0.0f;
-    }
-
-    return *std::max_element(normalizedValues.begin(), normalizedValues.end());
+    // scale {-32768 ... +32767} to {-MAX_AXIS_RANGE ... +MAX_AXIS_RANGE}
+    // and use the absolute value of it
+    return fabs(axisValue * MAX_AXIS_RANGE / MAX_SDL_RANGE);
 }
 
 std::string SDLAxisDirectionToAxisDirectionMapping::GetAxisDirectionMappingId() {
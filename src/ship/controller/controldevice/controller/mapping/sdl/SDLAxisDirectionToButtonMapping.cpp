@@ -18,27 +18,15 @@ SDLAxisDirectionToButtonMapping::SDLAxisDirectionToButtonMapping(uint8_t portInd
 }
 
 void SDLAxisDirectionToButtonMapping::UpdatePad(CONTROLLERBUTTONS_T& padButtons) {
-    if (mControlDeck->GamepadGameInputBlocked()) {
-        return;
+    // the stick/trigger thresholds are applied once per frame when the snapshot is taken
+    const auto& snapshot = mControlDeck->GetInputSnapshot();
+    if (!snapshot.GamepadBlocked && (snapshot.GetPort(mPortIndex).AxisDirections & GetSDLAxisDirectionMask())) {
+        padButtons |= mBitmask;
     }
+}
 
-    int32_t axisThresholdPercentage = 25;
-    if (AxisIsStick()) {
-        axisThresholdPercentage = mControlDeck->GetGlobalSDLDeviceSettings()->GetStickAxisThresholdPercentage();
-    } else if (AxisIsTrigger()) {
-        axisThresholdPercentage = mControlDeck->GetGlobalSDLDeviceSettings()->GetTriggerAxisThresholdPercentage();
-    }
-
-    for (const auto& [instanceId, gamepad] :
-         mControlDeck->GetConnectedPhysicalDeviceManager()->GetConnectedSDLGamepadsForPort(mPortIndex)) {
-        const auto axisValue = SDL_GetGamepadAxis(gamepad, mControllerAxis);
-
-        auto axisMinValue = SDL_JOYSTICK_AXIS_MAX * (axisThresholdPercentage / 100.0f);
-        if ((mAxisDirection == POSITIVE && axisValue > axisMinValue) ||
-            (mAxisDirection == NEGATIVE && axisValue < -axisMinValue)) {
-            padButtons |= mBitmask;
-        }
-    }
+uint64_t SDLAxisDirectionToButtonMapping::GetSDLAxisDirectionMask() {
+    return PortInputSnapshot::AxisDirectionBit(mControllerAxis, mAxisDirection == POSITIVE);
 }
 
 int8_t SDLAxisDirectionToButtonMapping::GetMappingType() {
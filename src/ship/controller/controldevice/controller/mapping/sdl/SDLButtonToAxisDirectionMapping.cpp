@@ -20,18 +20,12 @@ SDLButtonToAxisDirectionMapping::SDLButtonToAxisDirectionMapping(uint8_t portInd
 }
 
 float SDLButtonToAxisDirectionMapping::GetNormalizedAxisDirectionValue() {
-    if (mControlDeck->GamepadGameInputBlocked()) {
+    const auto& snapshot = mControlDeck->GetInputSnapshot();
+    if (snapshot.GamepadBlocked) {
         return 0.0f;
     }
 
-    for (const auto& [instanceId, gamepad] :
-         mControlDeck->GetConnectedPhysicalDeviceManager()->GetConnectedSDLGamepadsForPort(mPortIndex)) {
-        if (SDL_GetGamepadButton(gamepad, mControllerButton)) {
-            return MAX_AXIS_RANGE;
-        }
-    }
-
-    return 0.0f;
+    return (snapshot.GetPort(mPortIndex).Buttons & (1ULL << mControllerButton)) ? MAX_AXIS_RANGE : 0.0f;
 }
 
 std::string SDLButtonToAxisDirectionMapping::GetAxisDirectionMappingId() {
@@ -17,17 +17,14 @@ SDLButtonToButtonMapping::SDLButtonToButtonMapping(uint8_t portIndex, CONTROLLER
 }
 
 void SDLButtonToButtonMapping::UpdatePad(CONTROLLERBUTTONS_T& padButtons) {
-    if (mControlDeck->GamepadGameInputBlocked()) {
-        return;
+    const auto& snapshot = mControlDeck->GetInputSnapshot();
+    if (!snapshot.GamepadBlocked && (snapshot.GetPort(mPortIndex).Buttons & GetSDLButtonMask())) {
+        padButtons |= mBitmask;
     }
+}
 
-    for (const auto& [instanceId, gamepad] :
-         mControlDeck->GetConnectedPhysicalDeviceManager()->GetConnectedSDLGamepadsForPort(mPortIndex)) {
-        if (SDL_GetGamepadButton(gamepad, mControllerButton)) {
-            padButtons |= mBitmask;
-            return;
-        }
-    }
+uint64_t SDLButtonToButtonMapping::GetSDLButtonMask() {
+    return 1ULL << mControllerButton;
 }
 
 int8_t SDLButtonToButtonMapping::GetMappingType() {
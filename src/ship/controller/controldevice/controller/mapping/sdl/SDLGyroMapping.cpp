@@ -42,31 +42,18 @@ void SDLGyroMapping::Recalibrate() {
 }
 
 void SDLGyroMapping::UpdatePad(float& x, float& y) {
-    if (mControlDeck->GamepadGameInputBlocked()) {
+    const auto& snapshot = mControlDeck->GetInputSnapshot();
+    const auto& port = snapshot.GetPort(mPortIndex);
+
+    // if input is blocked or we didn't find a gyro device zero everything out
+    if (snapshot.GamepadBlocked || !port.HasGyro) {
         x = 0;
         y = 0;
         return;
     }
 
-    for (const auto& [instanceId, gamepad] :
-         mControlDeck->GetConnectedPhysicalDeviceManager()->GetConnectedSDLGamepadsForPort(mPortIndex)) {
-        if (!SDL_GamepadHasSensor(gamepad, SDL_SENSOR_GYRO)) {
-            continue;
-        }
-
-        // just use gyro on the first gyro supported device we find
-        float gyroData[3];
-        SDL_SetGamepadSensorEnabled(gamepad, SDL_SENSOR_GYRO, true);
-        SDL_GetGamepadSensorData(gamepad, SDL_SENSOR_GYRO, gyroData, 3);
-
-        x = (gyroData[0] - mNeutralPitch) * mSensitivity;
-        y = (gyroData[1] - mNeutralYaw) * mSensitivity;
-        return;
-    }
-
-    // if we didn't find a gyro device zero everything out
-    x = 0;
-    y = 0;
+    x = (port.Gyro[0] - mNeutralPitch) * mSensitivity;
+    y = (port.Gyro[1] - mNeutralYaw) * mSensitivity;
 }
 
 std::string SDLGyroMapping::GetGyroMappingId() {
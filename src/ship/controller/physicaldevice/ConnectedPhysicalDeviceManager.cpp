@@ -22,6 +22,10 @@ ConnectedPhysicalDeviceManager::GetConnectedSDLGamepadsForPort(uint8_t portIndex
     return result;
 }
 
+const std::unordered_map<int32_t, SDL_Gamepad*>& ConnectedPhysicalDeviceManager::GetConnectedSDLGamepads() const {
+    return mConnectedSDLGamepads;
+}
+
 std::unordered_map<int32_t, std::string> ConnectedPhysicalDeviceManager::GetConnectedSDLGamepadNames() {
     return mConnectedSDLGamepadNames;
 }
@@ -31,7 +35,8 @@ std::unordered_set<int32_t> ConnectedPhysicalDeviceManager::GetIgnoredInstanceId
 }
 
 bool ConnectedPhysicalDeviceManager::PortIsIgnoringInstanceId(uint8_t portIndex, int32_t instanceId) {
-    return GetIgnoredInstanceIdsForPort(portIndex).contains(instanceId);
+    const auto ignored = mIgnoredInstanceIds.find(portIndex);
+    return ignored != mIgnoredInstanceIds.end() && ignored->second.contains(instanceId);
 }
 
 void ConnectedPhysicalDeviceManager::IgnoreInstanceIdForPort(uint8_t portIndex, int32_t instanceId) {
@@ -4,6 +4,10 @@
 #include <cstring>
 #include <iostream>
 #include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <queue>
 #if defined(__APPLE__)
 #include <pwd.h>
@@ -185,9 +189,11 @@ std::shared_ptr<Context> Context::CreateDefaultInstance(const std::string& name,
 
 #ifdef ENABLE_SCRIPTING
     // ---- Script Loader ----
-    shared->GetChildren().Add(std::make_shared<ScriptLoader>(
+    auto scriptLoader = std::make_shared<ScriptLoader>(
         std::unordered_map<std::string, std::string>{}, 1, "-g -Wl", std::vector<std::string>{},
-        std::vector<std::string>{}, std::vector<std::string>{}, resourceManager));
+        std::vector<std::string>{}, std::vector<std::string>{}, resourceManager, threadPool);
+    scriptLoader->SetCacheDirectory(GetPathRelativeToAppDirectory("cache/scripts"));
+    shared->GetChildren().Add(scriptLoader);
 #endif
 
     // ---- Init all components that need it ----
@@ -406,9 +412,168 @@ void Context::UpdateElapsedTimeSeconds() {
     mElapsedTimeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - mInitTime).count();
 }
 
+static bool SharesResource(const std::vector<std::string>& a, const std::vector<std::string>& b) {
+    return std::any_of(a.begin(), a.end(),
+                       [&b](const std::string& resource) { return std::find(b.begin(), b.end(), resource) != b.end(); });
+}
+
+// Two components must tick in list order unless both declared what they touch and neither writes what the
+// other reads or writes.
+static bool MustTickInOrder(const TickableComponent& earlier, const TickableComponent& later) {
+    if (!earlier.HasTickDependencies() || !later.HasTickDependencies()) {
+        return true;
+    }
+    return SharesResource(earlier.GetTickWrites(), later.GetTickReads()) ||
+           SharesResource(earlier.GetTickWrites(), later.GetTickWrites()) ||
+           SharesResource(earlier.GetTickReads(), later.GetTickWrites());
+}
+
+void Context::RebuildTickSchedule() {
+    const auto tickables = mTickableComponents.Get();
+    mTickScheduleVersion = mTickableComponents.GetScheduleVersion();
+    mTickScheduleIsParallel = false;
+    mTickSchedule.clear();
+    mTickSchedule.resize(tickables->size());
+
+    for (size_t later = 0; later < tickables->size(); later++) {
+        TickNode& node = mTickSchedule[later];
+        node.Tickable = (*tickables)[later];
+        node.OnMainThread =
+            !node.Tickable->HasTickDependencies() || node.Tickable->GetTickAffinity() == TickAffinity::MainThread;
+        mTickScheduleIsParallel = mTickScheduleIsParallel || !node.OnMainThread;
+
+        for (size_t earlier = 0; earlier < later; earlier++) {
+            if (MustTickInOrder(*mTickSchedule[earlier].Tickable, *node.Tickable)) {
+                mTickSchedule[earlier].Successors.push_back(later);
+                node.Predecessors++;
+            }
+        }
+    }
+}
+
+// State of one parallel Tick(). Worker tasks hold it by value: a task that only starts after the tick returned
+// finds no ready node left to run and never touches the schedule.
+struct Context::TickRun {
+    EventID Event;
+    std::shared_ptr<ThreadPool> Pool;
+
+    std::mutex Mutex;
+    std::condition_variable Changed;
+    std::vector<size_t> Remaining;
+    std::vector<size_t> MainReady;
+    std::vector<size_t> AnyReady;
+    size_t Finished = 0;
+    // Nodes currently ticking on any thread.
+    size_t Running = 0;
+    // First exception thrown by a tickable; no further node starts once it is set.
+    std::exception_ptr Error;
+};
+
+void Context::MarkTickReady(const std::shared_ptr<TickRun>& run, size_t index) {
+    if (mTickSchedule[index].OnMainThread) {
+        run->MainReady.push_back(index);
+        return;
+    }
+
+    // AnyThread nodes can be picked up by a worker or by the calling thread, whichever gets to them first, so a
+    // busy pool never stalls the tick.
+    run->AnyReady.push_back(index);
+    run->Pool->Get()->submit_task([this, run]() { RunWorkerTicks(run); }, BS::pr::highest);
+}
+
+void Context::RunTickNode(const std::shared_ptr<TickRun>& run, std::unique_lock<std::mutex>& lock, size_t index) {
+    run->Running++;
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+        mTickSchedule[index].Tickable->Tick(run->Event);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    lock.lock();
+    run->Running--;
+
+    if (error != nullptr) {
+        if (run->Error == nullptr) {
+            run->Error = error;
+        }
+    } else {
+        run->Finished++;
+        for (size_t successor : mTickSchedule[index].Successors) {
+            if (--run->Remaining[successor] == 0) {
+                MarkTickReady(run, successor);
+            }
+        }
+    }
+    run->Changed.notify_all();
+}
+
+void Context::RunWorkerTicks(const std::shared_ptr<TickRun>& run) {
+    std::unique_lock<std::mutex> lock(run->Mutex);
+    while (run->Error == nullptr && !run->AnyReady.empty()) {
+        const size_t next = run->AnyReady.back();
+        run->AnyReady.pop_back();
+        RunTickNode(run, lock, next);
+    }
+}
+
 void Context::Tick(EventID eventId) {
-    for (const auto& tickable : *mTickableComponents.Get()) {
-        tickable->Tick(eventId);
+    if (mTickScheduleVersion != mTickableComponents.GetScheduleVersion()) {
+        RebuildTickSchedule();
+    }
+
+    auto threadPool = GetChildren().GetFirst<ThreadPool>();
+    if (!mTickScheduleIsParallel || threadPool == nullptr) {
+        // Every edge points forward, so list order satisfies the graph.
+        for (const auto& node : mTickSchedule) {
+            node.Tickable->Tick(eventId);
+        }
+        return;
+    }
+
+    auto run = std::make_shared<TickRun>();
+    run->Event = eventId;
+    run->Pool = threadPool;
+    run->Remaining.resize(mTickSchedule.size());
+
+    std::unique_lock<std::mutex> lock(run->Mutex);
+    for (size_t i = 0; i < mTickSchedule.size(); i++) {
+        run->Remaining[i] = mTickSchedule[i].Predecessors;
+    }
+    for (size_t i = 0; i < mTickSchedule.size(); i++) {
+        if (run->Remaining[i] == 0) {
+            MarkTickReady(run, i);
+        }
+    }
+
+    while (true) {
+        run->Changed.wait(lock, [&run, this]() {
+            if (run->Error != nullptr) {
+                // Nodes still ticking may read the schedule, so they finish before the error propagates.
+                return run->Running == 0;
+            }
+            return !run->MainReady.empty() || !run->AnyReady.empty() || run->Finished == mTickSchedule.size();
+        });
+        if (run->Error != nullptr) {
+            std::rethrow_exception(run->Error);
+        }
+        if (run->Finished == mTickSchedule.size()) {
+            // Worker tasks queued for nodes this thread already ran return without touching anything.
+            return;
+        }
+
+        // Keep main-thread work in list order; it is what the rest of the frame is usually waiting on.
+        size_t next;
+        if (!run->MainReady.empty()) {
+            auto first = std::min_element(run->MainReady.begin(), run->MainReady.end());
+            next = *first;
+            run->MainReady.erase(first);
+        } else {
+            next = run->AnyReady.back();
+            run->AnyReady.pop_back();
+        }
+
+        RunTickNode(run, lock, next);
     }
 }
 
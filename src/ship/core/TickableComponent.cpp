@@ -100,6 +100,41 @@ TickableComponent& TickableComponent::SetTickPriority(const TickPriority tickPri
     return *this;
 }
 
+TickableComponent& TickableComponent::SetTickDependencies(std::vector<std::string> reads,
+                                                          std::vector<std::string> writes) {
+    mTickReads = std::move(reads);
+    mTickWrites = std::move(writes);
+    mHasTickDependencies = true;
+    if (GetContext() != nullptr) {
+        GetContext()->GetTickableComponents().InvalidateSchedule();
+    }
+    return *this;
+}
+
+bool TickableComponent::HasTickDependencies() const {
+    return mHasTickDependencies;
+}
+
+const std::vector<std::string>& TickableComponent::GetTickReads() const {
+    return mTickReads;
+}
+
+const std::vector<std::string>& TickableComponent::GetTickWrites() const {
+    return mTickWrites;
+}
+
+TickableComponent& TickableComponent::SetTickAffinity(const TickAffinity tickAffinity) {
+    mTickAffinity = tickAffinity;
+    if (GetContext() != nullptr) {
+        GetContext()->GetTickableComponents().InvalidateSchedule();
+    }
+    return *this;
+}
+
+TickAffinity TickableComponent::GetTickAffinity() const {
+    return mTickAffinity;
+}
+
 TickableComponent& TickableComponent::SetContext(std::shared_ptr<Context> context) {
     auto self = std::dynamic_pointer_cast<TickableComponent>(TryGetSharedComponent());
     const auto& oldContext = GetContext();
@@ -1,6 +1,7 @@
 #include "ship/events/Events.h"
 #include <stdexcept>
 #include <algorithm>
+#include <string_view>
 
 #include "ship/events/CoreEvents.h"
 
@@ -112,7 +113,13 @@ void Events::CallEvent(const EventID id, IEvent* event, const char* file, const
         return;
     }
 
-    auto& info = registry->Callers[std::string(key)];
+    const std::string_view callerKey(key);
+    auto callerIt = registry->Callers.find(callerKey);
+    if (callerIt == registry->Callers.end()) {
+        callerIt = registry->Callers.emplace(std::string(callerKey), EventMetadata{ nullptr, 0, 0 }).first;
+    }
+
+    auto& info = callerIt->second;
     if (info.Path == nullptr) {
         info.Path = file;
         info.Line = line;
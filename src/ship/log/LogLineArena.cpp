@@ -0,0 +1,128 @@
+#include "ship/log/LogLineArena.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace Ship {
+
+LogLineArena::LogLineArena(size_t maxLines, size_t textCapacity)
+    : mMaxLines(std::max<size_t>(maxLines, 1)), mTextCapacity(std::max<size_t>(textCapacity, 2)) {
+}
+
+uint64_t LogLineArena::AppendV(spdlog::level::level_enum priority, const char* fmt, va_list args) {
+    if (mText.empty()) {
+        mText.resize(mTextCapacity);
+        mLines.resize(mMaxLines);
+    }
+
+    // Most lines fit in the free space after the head, so format there first and only fall back to making
+    // room (and formatting a second time) when the line turned out to be too long.
+    const size_t offset = mHead % mTextCapacity;
+    const size_t room = std::min(mTextCapacity - offset, mTextCapacity - UsedBytes());
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    const int size = vsnprintf(mText.data() + offset, room, fmt, argsCopy);
+    va_end(argsCopy);
+    if (size < 0) {
+        return mNextSeq;
+    }
+
+    if (static_cast<size_t>(size) < room) {
+        if (mNextSeq - mFirstSeq == mMaxLines) {
+            EvictOldest();
+        }
+        return Commit(mHead, static_cast<size_t>(size), priority);
+    }
+
+    const size_t length = std::min(static_cast<size_t>(size), mTextCapacity - 1);
+    const uint64_t start = Reserve(length + 1);
+    vsnprintf(mText.data() + start % mTextCapacity, length + 1, fmt, args);
+    return Commit(start, length, priority);
+}
+
+uint64_t LogLineArena::Append(spdlog::level::level_enum priority, std::string_view text) {
+    if (mText.empty()) {
+        mText.resize(mTextCapacity);
+        mLines.resize(mMaxLines);
+    }
+
+    const size_t length = std::min(text.size(), mTextCapacity - 1);
+    const uint64_t start = Reserve(length + 1);
+    char* dest = mText.data() + start % mTextCapacity;
+    memcpy(dest, text.data(), length);
+    dest[length] = '\0';
+    return Commit(start, length, priority);
+}
+
+void LogLineArena::Clear() {
+    mFirstSeq = 0;
+    mNextSeq = 0;
+    mHead = 0;
+}
+
+uint64_t LogLineArena::FirstSeq() const {
+    return mFirstSeq;
+}
+
+uint64_t LogLineArena::NextSeq() const {
+    return mNextSeq;
+}
+
+bool LogLineArena::Contains(uint64_t seq) const {
+    return seq >= mFirstSeq && seq < mNextSeq;
+}
+
+const char* LogLineArena::GetText(uint64_t seq) const {
+    return mText.data() + Record(seq).Start % mTextCapacity;
+}
+
+std::string_view LogLineArena::GetTextView(uint64_t seq) const {
+    return std::string_view(GetText(seq), Record(seq).Length);
+}
+
+spdlog::level::level_enum LogLineArena::GetPriority(uint64_t seq) const {
+    return Record(seq).Priority;
+}
+
+const LogLineArena::LineRecord& LogLineArena::Record(uint64_t seq) const {
+    return mLines[seq % mMaxLines];
+}
+
+uint64_t LogLineArena::Reserve(size_t size) {
+    if (mNextSeq - mFirstSeq == mMaxLines) {
+        EvictOldest();
+    }
+
+    // lines never straddle the end of the ring, so their text stays contiguous
+    uint64_t start = mHead;
+    const size_t offset = start % mTextCapacity;
+    if (offset + size > mTextCapacity) {
+        start += mTextCapacity - offset;
+    }
+    while (mFirstSeq != mNextSeq && start + size - Record(mFirstSeq).Start > mTextCapacity) {
+        EvictOldest();
+    }
+    return start;
+}
+
+uint64_t LogLineArena::Commit(uint64_t start, size_t length, spdlog::level::level_enum priority) {
+    LineRecord& record = mLines[mNextSeq % mMaxLines];
+    record.Start = start;
+    record.Length = static_cast<uint32_t>(length);
+    record.Priority = priority;
+    mHead = start + length + 1;
+    return mNextSeq++;
+}
+
+void LogLineArena::EvictOldest() {
+    mFirstSeq++;
+}
+
+size_t LogLineArena::UsedBytes() const {
+    if (mFirstSeq == mNextSeq) {
+        return 0;
+    }
+    return static_cast<size_t>(mHead - Record(mFirstSeq).Start);
+}
+} // namespace Ship
@@ -30,6 +30,11 @@ std::shared_ptr<spdlog::logger> Logger::Get() const {
     return mLogger;
 }
 
+size_t Logger::GetDroppedMessageCount() const {
+    auto threadPool = spdlog::thread_pool();
+    return threadPool != nullptr ? threadPool->overrun_counter() : 0;
+}
+
 void Logger::OnInit(const nlohmann::json& /*initArgs*/) {
     try {
         spdlog::init_thread_pool(8192, 1);
@@ -77,8 +82,10 @@ void Logger::OnInit(const nlohmann::json& /*initArgs*/) {
         mLogger->set_level(spdlog::level::debug);
         mLogger->flush_on(spdlog::level::trace);
 #else
+        // Never let a burst of log calls stall the game or render thread: when the queue is full, the oldest
+        // queued message is dropped and counted instead (see GetDroppedMessageCount()).
         mLogger = std::make_shared<spdlog::async_logger>(mAppName, sinks.begin(), sinks.end(), spdlog::thread_pool(),
-                                                         spdlog::async_overflow_policy::block);
+                                                         spdlog::async_overflow_policy::overrun_oldest);
         mLogger->set_level(spdlog::level::warn);
         mLogger->flush_on(spdlog::level::info);
 #endif
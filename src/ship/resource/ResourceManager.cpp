@@ -4,6 +4,7 @@
 #include "ship/resource/File.h"
 #include "ship/resource/archive/Archive.h"
 #include <algorithm>
+#include <fstream>
 #include <thread>
 #include <stdexcept>
 #include "ship/utils/StringHelper.h"
@@ -11,9 +12,16 @@
 #include "ship/config/ConsoleVariable.h"
 #include "ship/security/Keystore.h"
 #include "ship/thread/ThreadPool.h"
+#include "ship/utils/filesystemtools/FileHelper.h"
+#include "ship/utils/StrHash64.h"
 
 namespace Ship {
 
+namespace {
+// Set on thread pool workers while they run a manifest prefetch so archive reads can be attributed.
+thread_local bool tIsPrefetching = false;
+} // namespace
+
 ResourceFilter::ResourceFilter(const std::list<std::string>& includeMasks, const std::list<std::string>& excludeMasks,
                                const uintptr_t owner, const std::shared_ptr<Archive> parent)
     : IncludeMasks(includeMasks), ExcludeMasks(excludeMasks), Owner(owner), Parent(parent) {
@@ -27,6 +35,7 @@ void ResourceManager::OnInit(const nlohmann::json& initArgs) {
     auto archivePaths = initArgs.value("archivePaths", std::vector<std::string>{});
     auto hashesVec = initArgs.value("validHashes", std::vector<uint32_t>{});
     std::unordered_set<uint32_t> validHashes(hashesVec.begin(), hashesVec.end());
+    SetCacheBudget(initArgs.value("cacheBudget", static_cast<size_t>(0)));
 
     mResourceLoader =
         std::make_shared<ResourceLoader>(std::dynamic_pointer_cast<ResourceManager>(GetSharedComponent()));
@@ -157,6 +166,7 @@ std::shared_ptr<IResource> ResourceManager::LoadResourceProcess(const ResourceId
     }
 
     // Get the file from the OTR
+    (tIsPrefetching ? mPrefetchLoads : mDemandLoads)++;
     auto file = LoadFileProcess(identifier);
     if (file == nullptr) {
         if (identifier.IsPath()) {
@@ -164,7 +174,12 @@ std::shared_ptr<IResource> ResourceManager::LoadResourceProcess(const ResourceId
         } else {
             SPDLOG_TRACE("Failed to load resource file at hash {}", identifier.GetPathHash());
         }
-        mResourceCache[identifier] = ResourceLoadError::NotFound;
+        // Keep any replaced resource alive until the lock is released; its destructor may load other resources.
+        CacheValue previous;
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            previous = StoreCacheLine(identifier, ResourceLoadError::NotFound);
+        }
         return nullptr;
     }
 
@@ -175,6 +190,7 @@ std::shared_ptr<IResource> ResourceManager::LoadResourceProcess(const ResourceId
     // the cache.
     cachedResource = GetCachedResource(identifier, true);
 
+    CacheValue previous;
     {
         const std::lock_guard<std::mutex> lock(mMutex);
 
@@ -186,9 +202,9 @@ std::shared_ptr<IResource> ResourceManager::LoadResourceProcess(const ResourceId
 
         // Set the cache to the loaded resource
         if (resource != nullptr) {
-            mResourceCache[identifier] = resource;
+            previous = StoreCacheLine(identifier, resource);
         } else {
-            mResourceCache[identifier] = ResourceLoadError::NotFound;
+            previous = StoreCacheLine(identifier, ResourceLoadError::NotFound);
         }
     }
 
@@ -223,6 +239,8 @@ ResourceManager::LoadResourceAsync(const ResourceIdentifier& identifier, bool lo
         return LoadResourceAsync({ newFilePath, identifier.GetOwner(), identifier.GetParent() }, loadExact, priority);
     }
 
+    RecordAccess(identifier);
+
     // Check the cache before queueing the job.
     auto cacheCheck = GetCachedResource(identifier, loadExact);
     if (cacheCheck) {
@@ -288,7 +306,13 @@ ResourceManager::CheckCache(const ResourceIdentifier& identifier, bool loadExact
         return ResourceLoadError::NotCached;
     }
 
-    return cacheFind->second;
+    // Every hit moves the resource to the most recently used end of the eviction order.
+    auto& line = cacheFind->second;
+    if (std::holds_alternative<std::shared_ptr<IResource>>(line.Value)) {
+        mResourceLru.splice(mResourceLru.end(), mResourceLru, line.LruPosition);
+    }
+
+    return line.Value;
 }
 
 std::variant<ResourceManager::ResourceLoadError, std::shared_ptr<IResource>>
@@ -384,6 +408,37 @@ void ResourceManager::DirtyResources(const ResourceFilter& filter) {
     });
 }
 
+void ResourceManager::DirtyResources(const std::vector<uint64_t>& fileHashes) {
+    const std::lock_guard<std::mutex> lock(mMutex);
+    if (mResourceCache.empty()) {
+        return;
+    }
+
+    const std::unordered_set<uint64_t> changed(fileHashes.begin(), fileHashes.end());
+    for (auto it = mResourceCache.begin(); it != mResourceCache.end();) {
+        const auto& identifier = it->first;
+        // Resources pinned to a parent archive are not resolved through the archive manager.
+        if (identifier.GetParent() != nullptr) {
+            ++it;
+            continue;
+        }
+
+        const uint64_t hash = identifier.IsPath() ? CRC64(identifier.GetPath().c_str()) : identifier.GetPathHash();
+        if (!changed.contains(hash)) {
+            ++it;
+            continue;
+        }
+
+        auto resource = std::get_if<std::shared_ptr<IResource>>(&it->second.Value);
+        if (resource != nullptr && *resource != nullptr) {
+            (*resource)->Dirty();
+            ++it;
+        } else {
+            EraseCacheLine(it++);
+        }
+    }
+}
+
 void ResourceManager::DirtyResources(const std::string& searchMask) {
     DirtyResources({ { searchMask }, {}, mDefaultCacheOwner, mDefaultCacheArchive });
 }
@@ -424,12 +479,14 @@ size_t ResourceManager::UnloadResource(const ResourceIdentifier& identifier) {
     // Store a shared pointer here so that erase doesn't destruct the resource.
     // The resource will attempt to load other resources on the destructor, and this will fail because we already hold
     // the mutex.
-    std::variant<ResourceLoadError, std::shared_ptr<IResource>> value = nullptr;
+    CacheValue value = nullptr;
     size_t ret = 0;
-    // We can only erase the resource if we have any resources for that owner.
-    if (mResourceCache.contains(identifier)) {
+    {
         const std::lock_guard<std::mutex> lock(mMutex);
-        mResourceCache.erase(identifier);
+        auto cacheFind = mResourceCache.find(identifier);
+        if (cacheFind != mResourceCache.end()) {
+            value = EraseCacheLine(cacheFind);
+        }
     }
 
     return ret;
@@ -563,6 +620,223 @@ void* ResourceManager::GetResourceRawPointer(uint64_t crc) {
     return GetResourceRawPointer(resource);
 }
 
+ResourceManager::CacheValue ResourceManager::StoreCacheLine(const ResourceIdentifier& identifier, CacheValue value) {
+    auto [it, inserted] = mResourceCache.try_emplace(identifier);
+    auto& line = it->second;
+
+    CacheValue previous = std::move(line.Value);
+    if (!inserted && std::holds_alternative<std::shared_ptr<IResource>>(previous)) {
+        mResourceLru.erase(line.LruPosition);
+        mCachedBytes -= line.Bytes;
+    }
+
+    line.Value = std::move(value);
+    line.Bytes = 0;
+    if (std::holds_alternative<std::shared_ptr<IResource>>(line.Value)) {
+        const auto& resource = std::get<std::shared_ptr<IResource>>(line.Value);
+        line.Bytes = resource != nullptr ? resource->GetPointerSize() : 0;
+        line.LruPosition = mResourceLru.insert(mResourceLru.end(), identifier);
+        mCachedBytes += line.Bytes;
+    }
+
+    return previous;
+}
+
+ResourceManager::CacheValue
+ResourceManager::EraseCacheLine(std::unordered_map<ResourceIdentifier, CacheLine, ResourceIdentifierHash>::iterator it) {
+    CacheValue value = std::move(it->second.Value);
+    if (std::holds_alternative<std::shared_ptr<IResource>>(value)) {
+        mResourceLru.erase(it->second.LruPosition);
+        mCachedBytes -= it->second.Bytes;
+    }
+
+    mResourceCache.erase(it);
+    return value;
+}
+
+void ResourceManager::SetCacheBudget(size_t bytes) {
+    const std::lock_guard<std::mutex> lock(mMutex);
+    mCacheBudget = bytes;
+}
+
+size_t ResourceManager::GetCacheBudget() {
+    const std::lock_guard<std::mutex> lock(mMutex);
+    return mCacheBudget;
+}
+
+ResourceCacheStats ResourceManager::GetCacheStats() {
+    const std::lock_guard<std::mutex> lock(mMutex);
+    ResourceCacheStats stats;
+    stats.Resources = mResourceLru.size();
+    stats.Bytes = mCachedBytes;
+    stats.Budget = mCacheBudget;
+    stats.Evictions = mEvictionCount;
+    stats.EvictedBytes = mEvictedBytes;
+    stats.DemandLoads = mDemandLoads;
+    stats.PrefetchLoads = mPrefetchLoads;
+    return stats;
+}
+
+size_t ResourceManager::EvictToBudget(const std::function<void(IResource& resource)>& onEvicted) {
+    // Evicted resources are released only after the lock is dropped; their destructors may load other resources.
+    std::vector<std::shared_ptr<IResource>> evicted;
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+        if (mCacheBudget == 0 || mCachedBytes <= mCacheBudget) {
+            return 0;
+        }
+
+        for (auto lruIt = mResourceLru.begin(); lruIt != mResourceLru.end() && mCachedBytes > mCacheBudget;) {
+            auto cacheFind = mResourceCache.find(*lruIt++);
+            const auto& resource = std::get<std::shared_ptr<IResource>>(cacheFind->second.Value);
+
+            // Anything referenced outside the cache is in use and must stay resolvable.
+            if (resource.use_count() > 1) {
+                continue;
+            }
+
+            mEvictionCount++;
+            mEvictedBytes += cacheFind->second.Bytes;
+            evicted.push_back(std::get<std::shared_ptr<IResource>>(EraseCacheLine(cacheFind)));
+        }
+    }
+
+    if (onEvicted != nullptr) {
+        for (const auto& resource : evicted) {
+            if (resource != nullptr) {
+                onEvicted(*resource);
+            }
+        }
+    }
+
+    return evicted.size();
+}
+
+void ResourceManager::RecordAccess(const ResourceIdentifier& identifier) {
+    if (!mIsAccessRecording) {
+        return;
+    }
+
+    // Path and hash identifiers are cached separately, so each is recorded as the kind the caller used.
+    const auto& pathOrHash = identifier.GetPathOrHash();
+    const std::lock_guard<std::mutex> lock(mAccessManifestMutex);
+    if (mCurrentScene.empty() || !mRecordedInScene.insert(pathOrHash).second) {
+        return;
+    }
+
+    mAccessManifest[mCurrentScene].push_back(pathOrHash);
+}
+
+void ResourceManager::EnterScene(const std::string& sceneKey) {
+    std::vector<std::variant<std::string, uint64_t>> prefetchPaths;
+    {
+        const std::lock_guard<std::mutex> lock(mAccessManifestMutex);
+        mCurrentScene = sceneKey;
+        mRecordedInScene.clear();
+
+        auto sceneFind = mAccessManifest.find(sceneKey);
+        if (sceneFind != mAccessManifest.end()) {
+            prefetchPaths = sceneFind->second;
+            if (mIsAccessRecording) {
+                sceneFind->second.clear();
+            }
+        }
+    }
+
+    for (auto& pathOrHash : prefetchPaths) {
+        ResourceIdentifier identifier(std::string(), mDefaultCacheOwner, mDefaultCacheArchive);
+        identifier.SetPathOrHash(std::move(pathOrHash));
+        if (GetCachedResource(identifier, false) != nullptr) {
+            continue;
+        }
+
+        // Low priority keeps prefetches behind every load a caller is actually waiting on.
+        GetThreadPool()->Get()->submit_task(
+            [this, identifier]() {
+                tIsPrefetching = true;
+                LoadResourceProcess(identifier);
+                tIsPrefetching = false;
+            },
+            BS::pr::low);
+    }
+}
+
+void ResourceManager::SetAccessRecording(bool isEnabled) {
+    const std::lock_guard<std::mutex> lock(mAccessManifestMutex);
+    mIsAccessRecording = isEnabled;
+    mRecordedInScene.clear();
+}
+
+bool ResourceManager::IsAccessRecording() {
+    return mIsAccessRecording;
+}
+
+bool ResourceManager::LoadAccessManifest(const std::string& path) {
+    if (!FileHelper::Exists(path)) {
+        return false;
+    }
+
+    auto manifest = nlohmann::json::parse(FileHelper::ReadAllText(path), nullptr, false);
+    if (manifest.is_discarded() || !manifest.is_object() || !manifest.contains("scenes") ||
+        !manifest["scenes"].is_object()) {
+        SPDLOG_WARN("Ignoring malformed resource access manifest {}", path);
+        return false;
+    }
+
+    std::unordered_map<std::string, std::vector<std::variant<std::string, uint64_t>>> scenes;
+    for (auto& [sceneKey, entries] : manifest["scenes"].items()) {
+        if (!entries.is_array()) {
+            continue;
+        }
+        auto& scene = scenes[sceneKey];
+        for (auto& entry : entries) {
+            // Version 1 manifests list bare paths.
+            if (entry.is_string()) {
+                scene.push_back(entry.get<std::string>());
+            } else if (entry.is_object() && entry.value("kind", "") == "path" && entry.contains("path") &&
+                       entry["path"].is_string()) {
+                scene.push_back(entry["path"].get<std::string>());
+            } else if (entry.is_object() && entry.value("kind", "") == "hash" && entry.contains("hash") &&
+                       entry["hash"].is_number_unsigned()) {
+                scene.push_back(entry["hash"].get<uint64_t>());
+            }
+        }
+    }
+
+    const std::lock_guard<std::mutex> lock(mAccessManifestMutex);
+    mAccessManifest = std::move(scenes);
+    mRecordedInScene.clear();
+    return true;
+}
+
+bool ResourceManager::SaveAccessManifest(const std::string& path) {
+    nlohmann::json manifest;
+    manifest["version"] = 2;
+    manifest["scenes"] = nlohmann::json::object();
+    {
+        const std::lock_guard<std::mutex> lock(mAccessManifestMutex);
+        for (const auto& [sceneKey, entries] : mAccessManifest) {
+            auto& scene = manifest["scenes"][sceneKey] = nlohmann::json::array();
+            for (const auto& pathOrHash : entries) {
+                // CRC64 path hashes are stable across runs, so hash entries replay as-is.
+                if (std::holds_alternative<std::string>(pathOrHash)) {
+                    scene.push_back({ { "kind", "path" }, { "path", std::get<std::string>(pathOrHash) } });
+                } else {
+                    scene.push_back({ { "kind", "hash" }, { "hash", std::get<uint64_t>(pathOrHash) } });
+                }
+            }
+        }
+    }
+
+    std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    file << manifest.dump();
+    if (!file) {
+        SPDLOG_ERROR("Failed to write resource access manifest {}", path);
+        return false;
+    }
+    return true;
+}
+
 std::shared_ptr<ThreadPool> ResourceManager::GetThreadPool() {
     return mThreadPool;
 }
@@ -7,6 +7,7 @@
 #include "ship/resource/ResourceManager.h"
 #include "ship/resource/ResourceType.h"
 #include "ship/security/Keystore.h"
+#include "ship/thread/ThreadPool.h"
 #include "ship/utils/binarytools/MemoryStream.h"
 #include "ship/utils/glob.h"
 #include "ship/utils/StrHash64.h"
@@ -18,6 +19,11 @@
 #include <nlohmann/json.hpp>
 #include <monocypher-ed25519.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 namespace Ship {
 Archive::Archive(const std::string& path, std::shared_ptr<ResourceManager> resourceManager,
                  std::shared_ptr<Keystore> keystore)
@@ -75,6 +81,7 @@ void Archive::Load() {
             mManifest.Checksum = json.value("checksum", "");
             mManifest.Signature = json.value("signature", "");
             mManifest.PublicKey = json.value("public_key", "");
+            mManifest.SignatureVersion = json.value("signature_version", 1);
 
             if (mManifest.GameVersion != 0xFFFFFFFF) {
                 mHasGameVersion = true;
@@ -112,6 +119,16 @@ std::shared_ptr<File> Archive::LoadFile(uint64_t hash) {
     return LoadFile(filePath);
 }
 
+bool Archive::StreamFile(const std::string& filePath,
+                         const std::function<bool(const uint8_t* data, size_t size)>& consumer) {
+    auto file = LoadFile(filePath);
+    if (file == nullptr || !file->IsLoaded) {
+        return false;
+    }
+
+    return consumer(reinterpret_cast<const uint8_t*>(file->Buffer->data()), file->Buffer->size());
+}
+
 std::shared_ptr<std::unordered_map<uint64_t, std::string>> Archive::ListFiles() {
     return mHashes;
 }
@@ -180,6 +197,144 @@ void Archive::IndexFile(const std::string& filePath) {
     (*mHashes)[CRC64(filePath.c_str())] = filePath;
 }
 
+namespace {
+constexpr size_t kChecksumSize = 64;
+
+// Normalized path that is hashed, and the path the archive indexed the file under.
+using ValidatedFile = std::pair<std::string, std::string>;
+
+// Version 1: one BLAKE2b-512 over every path followed by its contents, in sorted path order.
+bool ComputeSequentialChecksum(Archive& archive, const std::vector<ValidatedFile>& files, uint8_t* checksum) {
+    crypto_blake2b_ctx ctx;
+    crypto_blake2b_init(&ctx, kChecksumSize);
+
+    for (const auto& [path, filePath] : files) {
+        crypto_blake2b_update(&ctx, reinterpret_cast<const uint8_t*>(path.c_str()), path.length());
+        const bool streamed = archive.StreamFile(filePath, [&ctx](const uint8_t* data, size_t size) {
+            crypto_blake2b_update(&ctx, data, size);
+            return true;
+        });
+        if (!streamed) {
+            SPDLOG_ERROR("Failed to load file {} from archive {} during validation", filePath, archive.GetPath());
+            return false;
+        }
+    }
+
+    crypto_blake2b_final(&ctx, checksum);
+    return true;
+}
+
+// State shared between the validating thread and the pool tasks helping it. Tasks hold it by value, so one that
+// only starts after every leaf is done finds no work and never touches the archive.
+struct TreeChecksumJob {
+    Archive* Source = nullptr;
+    std::vector<ValidatedFile> Files;
+    std::vector<uint8_t> Leaves;
+    std::atomic<size_t> NextFile = 0;
+    std::atomic<bool> Failed = false;
+
+    std::mutex FinishedMutex;
+    std::condition_variable FinishedCondition;
+    size_t Finished = 0; ///< Guarded by FinishedMutex. Counts every claimed leaf, including skipped ones.
+};
+
+void HashTreeLeaves(const std::shared_ptr<TreeChecksumJob>& job) {
+    for (size_t i = job->NextFile++; i < job->Files.size(); i = job->NextFile++) {
+        if (!job->Failed) {
+            const auto& [path, filePath] = job->Files[i];
+            const uint8_t separator = 0;
+
+            crypto_blake2b_ctx ctx;
+            crypto_blake2b_init(&ctx, kChecksumSize);
+            crypto_blake2b_update(&ctx, reinterpret_cast<const uint8_t*>(path.c_str()), path.length());
+            crypto_blake2b_update(&ctx, &separator, 1);
+            const bool streamed = job->Source->StreamFile(filePath, [&ctx](const uint8_t* data, size_t size) {
+                crypto_blake2b_update(&ctx, data, size);
+                return true;
+            });
+            if (streamed) {
+                crypto_blake2b_final(&ctx, job->Leaves.data() + i * kChecksumSize);
+            } else {
+                SPDLOG_ERROR("Failed to load file {} from archive {} during validation", filePath,
+                             job->Source->GetPath());
+                job->Failed = true;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(job->FinishedMutex);
+        if (++job->Finished == job->Files.size()) {
+            job->FinishedCondition.notify_all();
+        }
+    }
+}
+
+// Version 2: each file gets its own BLAKE2b-512 leaf over (path, 0x00, contents); the checksum is a BLAKE2b-512
+// over the leaves in sorted path order. Leaves are independent, so pool threads help hash them when the archive
+// supports concurrent streaming. The calling thread hashes leaves too, so a busy pool only slows it down.
+bool ComputeTreeChecksum(Archive& archive, std::vector<ValidatedFile> files, uint8_t* checksum,
+                         const std::shared_ptr<ThreadPool>& threadPool) {
+    auto job = std::make_shared<TreeChecksumJob>();
+    job->Source = &archive;
+    job->Files = std::move(files);
+    job->Leaves.resize(job->Files.size() * kChecksumSize);
+
+    if (threadPool != nullptr && archive.SupportsConcurrentStreaming() && job->Files.size() > 1) {
+        auto pool = threadPool->Get();
+        const size_t helperCount = std::min<size_t>({ pool->get_thread_count(), 7, job->Files.size() - 1 });
+        for (size_t i = 0; i < helperCount; i++) {
+            pool->detach_task([job]() { HashTreeLeaves(job); });
+        }
+    }
+
+    HashTreeLeaves(job);
+    {
+        std::unique_lock<std::mutex> lock(job->FinishedMutex);
+        job->FinishedCondition.wait(lock, [&job]() { return job->Finished == job->Files.size(); });
+    }
+
+    if (job->Failed) {
+        return false;
+    }
+
+    crypto_blake2b(checksum, kChecksumSize, job->Leaves.data(), job->Leaves.size());
+    return true;
+}
+} // namespace
+
+bool Archive::SupportsConcurrentStreaming() const {
+    return false;
+}
+
+bool Archive::ComputeChecksum(uint32_t signatureVersion, std::vector<uint8_t>& checksum) {
+    if (signatureVersion != 1 && signatureVersion != 2) {
+        return false;
+    }
+
+    std::vector<ValidatedFile> files;
+    files.reserve(mHashes->size());
+
+    for (const auto& [hash, filePath] : *mHashes) {
+        std::string normalizedPath = filePath;
+        std::replace(normalizedPath.begin(), normalizedPath.end(), '\\', '/');
+
+        if (normalizedPath == "manifest.json" || normalizedPath.back() == '/') {
+            continue;
+        }
+
+        files.emplace_back(std::move(normalizedPath), filePath);
+    }
+
+    std::sort(files.begin(), files.end());
+
+    checksum.resize(kChecksumSize);
+    if (signatureVersion == 1) {
+        return ComputeSequentialChecksum(*this, files, checksum.data());
+    }
+
+    auto threadPool = mResourceManager != nullptr ? mResourceManager->GetThreadPool() : nullptr;
+    return ComputeTreeChecksum(*this, std::move(files), checksum.data(), threadPool);
+}
+
 void Archive::Validate() {
 #ifdef ENABLE_SCRIPTING
     if (mManifest.Checksum.empty()) {
@@ -187,22 +342,27 @@ void Archive::Validate() {
         return;
     }
 
-    auto keystore = mKeystore;
-    if (keystore == nullptr) {
-        SPDLOG_WARN("Archive {} could not be validated because no keystore is available", GetPath());
+    if (mManifest.SignatureVersion != 1 && mManifest.SignatureVersion != 2) {
+        SPDLOG_ERROR("Archive {} uses unsupported signature version {}", GetPath(), mManifest.SignatureVersion);
         return;
     }
 
-    if (mResourceManager == nullptr) {
-        SPDLOG_WARN("Archive {} could not be validated because no resource manager is available", GetPath());
+    auto keystore = mKeystore;
+    if (keystore == nullptr) {
+        SPDLOG_WARN("Archive {} could not be validated because no keystore is available", GetPath());
         return;
     }
 
-    auto manager = mResourceManager->GetArchiveManager();
     std::vector<uint8_t> manifestKey = StringHelper::HexToBytes(mManifest.PublicKey);
+    KeystoreEntry signingKey;
 
-    if (!keystore->HasKey(manifestKey)) {
-        auto callback = manager->GetUntrustedArchiveHandler();
+    if (!keystore->FindKey(manifestKey, signingKey)) {
+        if (mResourceManager == nullptr) {
+            SPDLOG_WARN("Archive {} could not be validated because no resource manager is available", GetPath());
+            return;
+        }
+
+        auto callback = mResourceManager->GetArchiveManager()->GetUntrustedArchiveHandler();
         if (callback != nullptr) {
             auto key = KeystoreEntry{ mManifest.Author, manifestKey, KeyOrigin::User };
             bool isTrusted = callback(*this, key);
@@ -211,6 +371,7 @@ void Archive::Validate() {
                 return;
             }
             keystore->AddKey(mManifest.Author, manifestKey, key.Origin);
+            signingKey = key;
             SPDLOG_INFO("Added new public key for author {} to keystore.", mManifest.Author);
         } else {
             SPDLOG_ERROR("Archive {} is signed by an unknown author, and no handler is available to approve it.",
@@ -219,41 +380,11 @@ void Archive::Validate() {
         }
     }
 
-    std::vector<std::tuple<std::string, std::shared_ptr<File>>> files;
-
-    for (const auto& [hash, filePath] : *mHashes) {
-        std::string normalizedPath = filePath;
-        std::replace(normalizedPath.begin(), normalizedPath.end(), '\\', '/');
-
-        if (normalizedPath == "manifest.json" || normalizedPath.back() == '/') {
-            continue;
-        }
-
-        auto file = LoadFile(filePath);
-        if (file == nullptr || !file->IsLoaded) {
-            SPDLOG_ERROR("Failed to load file {} from archive {} during validation", filePath, GetPath());
-            return;
-        }
-
-        files.emplace_back(normalizedPath, file);
-    }
-
-    std::sort(files.begin(), files.end(),
-              [](const std::tuple<std::string, std::shared_ptr<File>>& a,
-                 const std::tuple<std::string, std::shared_ptr<File>>& b) { return std::get<0>(a) < std::get<0>(b); });
-
-    crypto_blake2b_ctx ctx;
-    crypto_blake2b_init(&ctx, 64);
-
-    for (const auto& [normalizedPath, file] : files) {
-        crypto_blake2b_update(&ctx, reinterpret_cast<const uint8_t*>(normalizedPath.c_str()), normalizedPath.length());
-        if (file->Buffer->size() > 0) {
-            crypto_blake2b_update(&ctx, reinterpret_cast<const uint8_t*>(file->Buffer->data()), file->Buffer->size());
-        }
+    std::vector<uint8_t> rawHash;
+    if (!ComputeChecksum(mManifest.SignatureVersion, rawHash)) {
+        return;
     }
 
-    std::vector<uint8_t> rawHash(64);
-    crypto_blake2b_final(&ctx, rawHash.data());
     std::string calculatedChecksumHex = StringHelper::BytesToHex(rawHash);
     if (calculatedChecksumHex != mManifest.Checksum) {
         SPDLOG_ERROR("Checksum validation failed for archive {}. Expected {}, got {}", GetPath(), mManifest.Checksum,
@@ -277,14 +408,19 @@ void Archive::Validate() {
         return;
     }
 
-    bool validSignature = false;
+    bool validSignature = signingKey.Data.size() == 32 &&
+                          crypto_ed25519_check(signature.data(), signingKey.Data.data(), rawHash.data(),
+                                               rawHash.size()) == 0;
 
-    for (const auto& key : keystore->GetAllKeys()) {
-        const int status = crypto_ed25519_check(signature.data(), key.Data.data(), rawHash.data(), rawHash.size());
+    // Version 1 archives were accepted when signed by any trusted key, whatever their manifest named.
+    if (!validSignature && mManifest.SignatureVersion == 1) {
+        for (const auto& key : keystore->GetAllKeys()) {
+            const int status = crypto_ed25519_check(signature.data(), key.Data.data(), rawHash.data(), rawHash.size());
 
-        if (status == 0) {
-            validSignature = true;
-            break;
+            if (status == 0) {
+                validSignature = true;
+                break;
+            }
         }
     }
 
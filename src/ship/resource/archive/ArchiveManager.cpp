@@ -1,9 +1,11 @@
 #include "ship/resource/archive/ArchiveManager.h"
 
+#include <algorithm>
 #include <filesystem>
 #include "spdlog/spdlog.h"
 
 #include "ship/resource/archive/Archive.h"
+#include "ship/resource/ResourceManager.h"
 #ifdef INCLUDE_MPQ_SUPPORT
 #include "ship/resource/archive/OtrArchive.h"
 #endif
@@ -48,12 +50,12 @@ std::shared_ptr<File> ArchiveManager::LoadFile(const std::string& filePath) {
 }
 
 std::shared_ptr<File> ArchiveManager::LoadFile(uint64_t hash) {
-    auto archive = mFileToArchive[hash];
-    if (archive == nullptr) {
+    auto archiveFind = mFileToArchive.find(hash);
+    if (archiveFind == mFileToArchive.end()) {
         return nullptr;
     }
 
-    return archive->LoadFile(hash);
+    return archiveFind->second->LoadFile(hash);
 }
 
 bool ArchiveManager::HasFile(const std::string& filePath) {
@@ -65,7 +67,8 @@ bool ArchiveManager::HasFile(uint64_t hash) {
 }
 
 std::shared_ptr<Archive> ArchiveManager::GetArchiveFromFile(const std::string& filePath) {
-    return mFileToArchive[CRC64(filePath.c_str())];
+    auto archiveFind = mFileToArchive.find(CRC64(filePath.c_str()));
+    return archiveFind != mFileToArchive.end() ? archiveFind->second : nullptr;
 }
 
 std::shared_ptr<std::vector<std::string>> ArchiveManager::ListFiles(const std::string& searchMask) {
@@ -78,40 +81,76 @@ std::shared_ptr<std::vector<std::string>> ArchiveManager::ListFiles(const std::s
 
 std::shared_ptr<std::vector<std::string>> ArchiveManager::ListFiles(const std::list<std::string>& includes,
                                                                     const std::list<std::string>& excludes) {
-    auto list = std::make_shared<std::vector<std::string>>();
-    for (const auto& [hash, path] : mHashes) {
-        if (includes.empty() && excludes.empty()) {
-            list->push_back(path);
-            continue;
+    std::vector<std::string_view> matches;
+    if (includes.empty()) {
+        matches.assign(mSortedPaths.begin(), mSortedPaths.end());
+    } else {
+        for (const auto& filter : includes) {
+            MatchFiles(filter, matches);
         }
-        bool includeMatch = includes.empty();
-        if (!includes.empty()) {
-            for (std::string filter : includes) {
-                if (glob_match(filter.c_str(), path.c_str())) {
-                    includeMatch = true;
-                    break;
-                }
-            }
+        if (includes.size() > 1) {
+            std::sort(matches.begin(), matches.end());
+            matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
         }
+    }
+
+    auto list = std::make_shared<std::vector<std::string>>();
+    list->reserve(matches.size());
+    for (const auto& path : matches) {
+        // Index entries view std::strings, so data() is null-terminated.
         bool excludeMatch = false;
-        if (!excludes.empty()) {
-            for (std::string filter : excludes) {
-                if (glob_match(filter.c_str(), path.c_str())) {
-                    excludeMatch = true;
-                    break;
-                }
+        for (const auto& filter : excludes) {
+            if (glob_match(filter.c_str(), path.data())) {
+                excludeMatch = true;
+                break;
             }
         }
-        if (includeMatch && !excludeMatch) {
-            list->push_back(path);
+        if (!excludeMatch) {
+            list->emplace_back(path);
         }
     }
     return list;
 }
 
+std::span<const std::string_view> ArchiveManager::ListFilesWithPrefix(std::string_view prefix) const {
+    auto begin = std::lower_bound(mSortedPaths.begin(), mSortedPaths.end(), prefix);
+    auto end = std::partition_point(begin, mSortedPaths.end(),
+                                    [prefix](std::string_view path) { return path.starts_with(prefix); });
+    return { begin, end };
+}
+
+void ArchiveManager::MatchFiles(const std::string& pattern, std::vector<std::string_view>& matches) const {
+    const size_t prefixLength = std::min(pattern.find_first_of("*?[\\"), pattern.size());
+    const char* tail = pattern.c_str() + prefixLength;
+
+    for (const auto& path : ListFilesWithPrefix(std::string_view(pattern).substr(0, prefixLength))) {
+        if (glob_match(tail, path.data() + prefixLength)) {
+            matches.push_back(path);
+        }
+    }
+}
+
+void ArchiveManager::IndexPaths(std::vector<std::string_view>& paths) {
+    std::sort(paths.begin(), paths.end());
+    const auto middle = static_cast<std::ptrdiff_t>(mSortedPaths.size());
+    mSortedPaths.insert(mSortedPaths.end(), paths.begin(), paths.end());
+    std::inplace_merge(mSortedPaths.begin(), mSortedPaths.begin() + middle, mSortedPaths.end());
+}
+
+void ArchiveManager::UnindexPaths(std::vector<std::string_view>& paths) {
+    std::sort(paths.begin(), paths.end());
+    auto removed = paths.begin();
+    std::erase_if(mSortedPaths, [&](std::string_view path) {
+        while (removed != paths.end() && *removed < path) {
+            ++removed;
+        }
+        return removed != paths.end() && *removed == path;
+    });
+}
+
 std::shared_ptr<std::vector<std::string>> ArchiveManager::ListDirectories(const std::string& searchMask) {
     auto list = std::make_shared<std::vector<std::string>>();
-    for (const std::string& dir : mDirectories) {
+    for (const auto& [dir, fileCount] : mDirectories) {
         if (glob_match(searchMask.c_str(), dir.c_str())) {
             list->push_back(dir);
         }
@@ -142,7 +181,11 @@ void ArchiveManager::ResetVirtualFileSystem() {
     mArchives.clear();
     mGameVersions.clear();
     mHashes.clear();
+    mSortedPaths.clear();
+    mDirectories.clear();
     mFileToArchive.clear();
+    mFileOverrides.clear();
+    mArchiveFiles.clear();
     for (const auto& archive : archives) {
         archive->Unload();
         archive->Load();
@@ -155,8 +198,28 @@ bool ArchiveManager::WriteFile(std::shared_ptr<Archive> archive, const std::stri
     if (archive) {
         if (archive->WriteFile(filePath, data)) {
             auto hash = CRC64(filePath.c_str());
-            mHashes[hash] = filePath;
+            auto [hashIt, isNewPath] = mHashes.try_emplace(hash, filePath);
+            if (isNewPath) {
+                std::string_view path = hashIt->second;
+                mSortedPaths.insert(std::lower_bound(mSortedPaths.begin(), mSortedPaths.end(), path), path);
+            }
             mFileToArchive[hash] = archive;
+
+            // Written files win over every other archive until the file system is rebuilt.
+            auto filesFind = mArchiveFiles.find(archive);
+            if (filesFind != mArchiveFiles.end()) {
+                auto& overrides = mFileOverrides[hash];
+                auto overrideFind = std::find(overrides.begin(), overrides.end(), archive);
+                if (overrideFind == overrides.end()) {
+                    filesFind->second.push_back(hash);
+                    ReferenceDirectory(filePath, true);
+                } else {
+                    overrides.erase(overrideFind);
+                }
+                overrides.push_back(archive);
+            }
+
+            NotifyFilesChanged({ hash });
             return true; // Successfully wrote file
         }
     }
@@ -164,16 +227,59 @@ bool ArchiveManager::WriteFile(std::shared_ptr<Archive> archive, const std::stri
 }
 
 size_t ArchiveManager::RemoveArchive(const std::string& path) {
-    for (size_t i = 0; i < mArchives.size(); i++) {
-        if (path == mArchives[i]->GetPath()) {
-            mArchives[i]->Unload();
-            mArchives.erase(mArchives.begin() + i);
-            ResetVirtualFileSystem();
-            return 1;
+    auto archiveFind = std::find_if(mArchives.begin(), mArchives.end(),
+                                    [&path](const auto& archive) { return archive->GetPath() == path; });
+    if (archiveFind == mArchives.end()) {
+        return 0;
+    }
+
+    auto archive = *archiveFind;
+    mArchives.erase(archiveFind);
+    if (archive->HasGameVersion()) {
+        auto versionFind = std::find(mGameVersions.begin(), mGameVersions.end(), archive->GetGameVersion());
+        if (versionFind != mGameVersions.end()) {
+            mGameVersions.erase(versionFind);
+        }
+    }
+
+    std::vector<uint64_t> changed;
+    std::vector<uint64_t> erased;
+    auto filesFind = mArchiveFiles.find(archive);
+    if (filesFind != mArchiveFiles.end()) {
+        for (uint64_t hash : filesFind->second) {
+            auto& overrides = mFileOverrides[hash];
+            const bool wasWinner = !overrides.empty() && overrides.back() == archive;
+            overrides.erase(std::remove(overrides.begin(), overrides.end(), archive), overrides.end());
+            ReferenceDirectory(mHashes[hash], false);
+
+            if (overrides.empty()) {
+                mFileOverrides.erase(hash);
+                mFileToArchive.erase(hash);
+                erased.push_back(hash);
+            } else if (wasWinner) {
+                mFileToArchive[hash] = overrides.back();
+            } else {
+                continue;
+            }
+            changed.push_back(hash);
         }
+        mArchiveFiles.erase(filesFind);
     }
 
-    return 0;
+    // The index views mHashes' strings, so it has to let go of them first.
+    std::vector<std::string_view> erasedPaths;
+    erasedPaths.reserve(erased.size());
+    for (uint64_t hash : erased) {
+        erasedPaths.push_back(mHashes[hash]);
+    }
+    UnindexPaths(erasedPaths);
+    for (uint64_t hash : erased) {
+        mHashes.erase(hash);
+    }
+
+    archive->Unload();
+    NotifyFilesChanged(changed);
+    return 1;
 }
 
 size_t ArchiveManager::RemoveArchive(std::shared_ptr<Archive> archive) {
@@ -275,24 +381,60 @@ std::shared_ptr<Archive> ArchiveManager::AddArchive(std::shared_ptr<Archive> arc
 
     SPDLOG_INFO("Adding Archive {} to Archive Manager", archive->GetPath());
 
+    if (mArchiveFiles.contains(archive)) {
+        SPDLOG_WARN("Archive {} is already added to Archive Manager", archive->GetPath());
+        return archive;
+    }
+
     mArchives.push_back(archive);
     if (archive->HasGameVersion()) {
         mGameVersions.push_back(archive->GetGameVersion());
     }
     const auto fileList = archive->ListFiles();
+    auto& archiveFiles = mArchiveFiles[archive];
+    archiveFiles.reserve(fileList->size());
+    std::vector<std::string_view> newPaths;
     for (auto& [hash, filename] : *fileList.get()) {
-        mHashes[hash] = filename;
-        mFileToArchive[hash] = archive;
-
-        size_t lastSlash = filename.find_last_of('/');
-        if (lastSlash != std::string::npos) {
-            std::string dir = filename.substr(0, lastSlash);
-            mDirectories.insert(dir);
+        auto [hashIt, isNewPath] = mHashes.try_emplace(hash, filename);
+        if (isNewPath) {
+            newPaths.push_back(hashIt->second);
         }
+        mFileToArchive[hash] = archive;
+        mFileOverrides[hash].push_back(archive);
+        archiveFiles.push_back(hash);
+        ReferenceDirectory(filename, true);
     }
+    IndexPaths(newPaths);
+
+    // The newest archive wins every hash it provides.
+    NotifyFilesChanged(archiveFiles);
     return archive;
 }
 
+void ArchiveManager::ReferenceDirectory(const std::string& filePath, bool isAdding) {
+    size_t lastSlash = filePath.find_last_of('/');
+    if (lastSlash == std::string::npos) {
+        return;
+    }
+
+    std::string dir = filePath.substr(0, lastSlash);
+    if (isAdding) {
+        mDirectories[dir]++;
+        return;
+    }
+
+    auto dirFind = mDirectories.find(dir);
+    if (dirFind != mDirectories.end() && --dirFind->second == 0) {
+        mDirectories.erase(dirFind);
+    }
+}
+
+void ArchiveManager::NotifyFilesChanged(const std::vector<uint64_t>& hashes) {
+    if (mResourceManager != nullptr && !hashes.empty()) {
+        mResourceManager->DirtyResources(hashes);
+    }
+}
+
 bool ArchiveManager::IsGameVersionValid(uint32_t gameVersion) {
     return mValidGameVersions.empty() || mValidGameVersions.contains(gameVersion);
 }
@@ -6,9 +6,199 @@
 
 #include "spdlog/spdlog.h"
 #include "ship/utils/filesystemtools/FileHelper.h"
+#include "ship/utils/StrHash64.h"
 #include "ship/resource/ResourceManager.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace Ship {
+namespace {
+// Reads a whole file straight into a new File::Buffer. A missing file is reported by returning nullptr,
+// so callers never need a separate existence check.
+std::shared_ptr<std::vector<char>> ReadWholeFile(const std::string& path) {
+#if defined(_WIN32)
+    std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file) {
+        return nullptr;
+    }
+
+    const std::streamsize size = file.tellg();
+    if (size < 0) {
+        return nullptr;
+    }
+    auto buffer = std::make_shared<std::vector<char>>(static_cast<size_t>(size));
+    file.seekg(0, std::ios::beg);
+    file.read(buffer->data(), size);
+    buffer->resize(static_cast<size_t>(file.gcount()));
+    return buffer;
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return nullptr;
+    }
+
+    auto buffer = std::make_shared<std::vector<char>>(static_cast<size_t>(st.st_size));
+    size_t total = 0;
+    while (total < buffer->size()) {
+        const ssize_t count = read(fd, buffer->data() + total, buffer->size() - total);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            break;
+        }
+        total += static_cast<size_t>(count);
+    }
+    close(fd);
+
+    // the file may have shrunk between fstat and read
+    buffer->resize(total);
+    return buffer;
+#endif
+}
+
+std::shared_ptr<File> LoadDiskFile(const std::string& path) {
+    auto buffer = ReadWholeFile(path);
+    if (buffer == nullptr) {
+        return nullptr;
+    }
+
+    auto fileToLoad = std::make_shared<File>();
+    fileToLoad->Buffer = std::move(buffer);
+    fileToLoad->IsLoaded = true;
+    return fileToLoad;
+}
+
+bool StreamDiskFile(const std::string& path, const std::function<bool(const uint8_t* data, size_t size)>& consumer) {
+    std::vector<uint8_t> chunk(64 * 1024);
+#if defined(_WIN32)
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    while (file) {
+        file.read(reinterpret_cast<char*>(chunk.data()), chunk.size());
+        const size_t count = static_cast<size_t>(file.gcount());
+        if (count > 0 && !consumer(chunk.data(), count)) {
+            return false;
+        }
+    }
+    return file.eof();
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return false;
+    }
+
+    bool completed = false;
+    while (true) {
+        const ssize_t count = read(fd, chunk.data(), chunk.size());
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            completed = count == 0;
+            break;
+        }
+        if (!consumer(chunk.data(), static_cast<size_t>(count))) {
+            break;
+        }
+    }
+    close(fd);
+    return completed;
+#endif
+}
+
+// Recursively lists the regular files below root as paths relative to it, using '/' separators. Directories
+// are handed out from a shared stack so that uneven subtrees still keep every worker busy.
+std::vector<std::string> WalkDirectoryTree(const std::filesystem::path& root) {
+    std::vector<std::pair<std::filesystem::path, std::string>> pending = { { root, "" } };
+    std::vector<std::string> files;
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    size_t busyWorkers = 0;
+
+    auto worker = [&]() {
+        std::vector<std::string> localFiles;
+        std::vector<std::pair<std::filesystem::path, std::string>> localDirs;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            workAvailable.wait(lock, [&]() { return !pending.empty() || busyWorkers == 0; });
+            if (pending.empty()) {
+                break;
+            }
+
+            auto [directory, prefix] = std::move(pending.back());
+            pending.pop_back();
+            busyWorkers++;
+            lock.unlock();
+
+            std::error_code ec;
+            for (std::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+                const auto& entry = *it;
+                std::error_code statEc;
+                const std::string relative = prefix + entry.path().filename().generic_string();
+                if (entry.is_directory(statEc)) {
+                    // like recursive_directory_iterator's default, do not descend into symlinked directories
+                    if (!entry.is_symlink(statEc)) {
+                        localDirs.emplace_back(entry.path(), relative + "/");
+                    }
+                } else {
+                    localFiles.push_back(relative);
+                }
+            }
+
+            lock.lock();
+            busyWorkers--;
+            for (auto& dir : localDirs) {
+                pending.push_back(std::move(dir));
+            }
+            localDirs.clear();
+            workAvailable.notify_all();
+        }
+
+        files.insert(files.end(), std::make_move_iterator(localFiles.begin()),
+                     std::make_move_iterator(localFiles.end()));
+        workAvailable.notify_all();
+    };
+
+    const size_t workerCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, 8);
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < workerCount; i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    return files;
+}
+} // namespace
+
 FolderArchive::FolderArchive(const std::string& archivePath, std::shared_ptr<ResourceManager> resourceManager,
                              std::shared_ptr<Keystore> keystore)
     : Archive(archivePath, std::move(resourceManager), std::move(keystore)) {
@@ -20,11 +210,19 @@ Ship::FolderArchive::~FolderArchive() {
 }
 
 bool FolderArchive::Open() {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(mArchiveBasePath, ec)) {
+        return true;
+    }
 
-    auto fileEntries = Directory::ListFiles(mArchiveBasePath);
+    auto fileEntries = WalkDirectoryTree(mArchiveBasePath);
+    // keep indexing order deterministic regardless of how the walk was split across threads
+    std::sort(fileEntries.begin(), fileEntries.end());
 
-    for (auto i = 0; i < fileEntries.size(); i++) {
-        auto filePath = StringHelper::Split(fileEntries[i], mArchiveBasePath)[1];
+    std::unique_lock<std::shared_mutex> lock(mDiskPathsMutex);
+    mDiskPaths.reserve(fileEntries.size());
+    for (const auto& filePath : fileEntries) {
+        mDiskPaths[CRC64(filePath.c_str())] = mArchiveBasePath + filePath;
         IndexFile(filePath);
     }
 
@@ -32,11 +230,16 @@ bool FolderArchive::Open() {
 }
 
 bool FolderArchive::Close() {
+    std::unique_lock<std::shared_mutex> lock(mDiskPathsMutex);
+    mDiskPaths.clear();
     return true;
 }
 
 bool FolderArchive::WriteFile(const std::string& filename, const std::vector<uint8_t>& data) {
     Ship::FileHelper::WriteAllBytes(mArchiveBasePath + filename, data);
+
+    std::unique_lock<std::shared_mutex> lock(mDiskPathsMutex);
+    mDiskPaths[CRC64(filename.c_str())] = mArchiveBasePath + filename;
     return true;
 }
 
@@ -45,30 +248,58 @@ std::shared_ptr<File> Ship::FolderArchive::LoadFile(const std::string& filePath)
 }
 
 std::shared_ptr<File> Ship::FolderArchive::LoadFile(uint64_t hash) {
-    const std::string& filePath = *mResourceManager->GetArchiveManager()->HashToString(hash);
+    return LoadFileRaw(hash);
+}
 
-    return LoadFileRaw(filePath);
+bool FolderArchive::ResolveDiskPath(uint64_t hash, std::string& diskPath) {
+    std::shared_lock<std::shared_mutex> lock(mDiskPathsMutex);
+    auto it = mDiskPaths.find(hash);
+    if (it == mDiskPaths.end()) {
+        return false;
+    }
+
+    diskPath = it->second;
+    return true;
 }
 
 std::shared_ptr<File> FolderArchive::LoadFileRaw(const std::string& filePath) {
-    if (Ship::FileHelper::Exists(mArchiveBasePath + filePath)) {
-        auto data = Ship::FileHelper::ReadAllBytes(mArchiveBasePath + filePath);
-        auto fileToLoad = std::make_shared<File>();
-
-        fileToLoad->Buffer = std::make_shared<std::vector<char>>(data.size());
-        memcpy(fileToLoad->Buffer->data(), data.data(), data.size());
+    std::string diskPath;
+    if (!ResolveDiskPath(CRC64(filePath.c_str()), diskPath)) {
+        // not present when the archive was opened; it may have been added since
+        diskPath = mArchiveBasePath + filePath;
+    }
 
-        fileToLoad->IsLoaded = true;
+    return LoadDiskFile(diskPath);
+}
 
-        return fileToLoad;
-    } else {
-        return nullptr;
+bool FolderArchive::StreamFile(const std::string& filePath,
+                               const std::function<bool(const uint8_t* data, size_t size)>& consumer) {
+    std::string diskPath;
+    if (!ResolveDiskPath(CRC64(filePath.c_str()), diskPath)) {
+        diskPath = mArchiveBasePath + filePath;
     }
+
+    return StreamDiskFile(diskPath, consumer);
+}
+
+bool FolderArchive::SupportsConcurrentStreaming() const {
+    return true;
 }
 
 std::shared_ptr<File> FolderArchive::LoadFileRaw(uint64_t hash) {
-    const std::string& filePath = *mResourceManager->GetArchiveManager()->HashToString(hash);
+    std::string diskPath;
+    if (!ResolveDiskPath(hash, diskPath)) {
+        if (mResourceManager == nullptr) {
+            return nullptr;
+        }
 
-    return LoadFileRaw(filePath);
+        const std::string* filePath = mResourceManager->GetArchiveManager()->HashToString(hash);
+        if (filePath == nullptr) {
+            return nullptr;
+        }
+        diskPath = mArchiveBasePath + *filePath;
+    }
+
+    return LoadDiskFile(diskPath);
 }
 } // namespace Ship
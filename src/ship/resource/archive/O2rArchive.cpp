@@ -94,6 +94,49 @@ std::shared_ptr<File> O2rArchive::LoadFile(const std::string& filePath) {
     return fileToLoad;
 }
 
+bool O2rArchive::StreamFile(const std::string& filePath,
+                            const std::function<bool(const uint8_t* data, size_t size)>& consumer) {
+    zip_t* zipArchive = GetZipHandle();
+    if (zipArchive == nullptr) {
+        SPDLOG_TRACE("Failed to open file {} from zip archive {}. Archive not open.", filePath, GetPath());
+        return false;
+    }
+
+    struct zip_file* zipEntryFile = zip_fopen(zipArchive, filePath.c_str(), 0);
+    if (!zipEntryFile) {
+        SPDLOG_TRACE("Failed to open file {} in zip archive  {}.", filePath, GetPath());
+        ReleaseZipHandle(zipArchive);
+        return false;
+    }
+
+    std::vector<uint8_t> chunk(64 * 1024);
+    bool completed = false;
+    while (true) {
+        const zip_int64_t count = zip_fread(zipEntryFile, chunk.data(), chunk.size());
+        if (count <= 0) {
+            completed = count == 0;
+            if (count < 0) {
+                SPDLOG_TRACE("Error reading file {} in zip archive  {}.", filePath, GetPath());
+            }
+            break;
+        }
+        if (!consumer(chunk.data(), static_cast<size_t>(count))) {
+            break;
+        }
+    }
+
+    if (zip_fclose(zipEntryFile) != 0) {
+        SPDLOG_TRACE("Error closing file {} in zip archive  {}.", filePath, GetPath());
+    }
+
+    ReleaseZipHandle(zipArchive);
+    return completed;
+}
+
+bool O2rArchive::SupportsConcurrentStreaming() const {
+    return true;
+}
+
 bool O2rArchive::Open() {
     mZipArchive = zip_open(GetPath().c_str(), ZIP_CREATE, nullptr);
     if (mZipArchive == nullptr) {
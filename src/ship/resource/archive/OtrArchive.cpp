@@ -19,14 +19,47 @@ OtrArchive::~OtrArchive() {
     SPDLOG_TRACE("destruct otrarchive: {}", GetPath());
 }
 
-std::shared_ptr<File> OtrArchive::LoadFile(const std::string& filePath) {
-    if (mHandle == nullptr) {
-        SPDLOG_TRACE("Failed to open file {} from mpq archive {}. Archive not open.", filePath, GetPath());
+HANDLE OtrArchive::GetMpqHandle() {
+    {
+        std::lock_guard<std::mutex> lock(mPoolMutex);
+        if (!mIsOpen) {
+            return nullptr;
+        }
+        if (!mMpqHandlePool.empty()) {
+            HANDLE handle = mMpqHandlePool.back();
+            mMpqHandlePool.pop_back();
+            return handle;
+        }
+    }
+
+    HANDLE handle = nullptr;
+    if (!SFileOpenArchive(GetPath().c_str(), 0, MPQ_OPEN_READ_ONLY, &handle)) {
+        SPDLOG_ERROR("({}) Failed to open pooled handle for mpq file \"{}\"", GetLastError(), GetPath());
         return nullptr;
     }
+    return handle;
+}
 
+void OtrArchive::ReleaseMpqHandle(HANDLE handle) {
+    if (handle == nullptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mPoolMutex);
+    if (mIsOpen) {
+        mMpqHandlePool.push_back(handle);
+        return;
+    }
+
+    // The archive was closed while this handle was in use, so nothing would ever close it from the pool.
+    if (!SFileCloseArchive(handle)) {
+        SPDLOG_ERROR("({}) Failed to close pooled mpq handle {}", GetLastError(), GetPath());
+    }
+}
+
+std::shared_ptr<File> OtrArchive::ReadFile(HANDLE archiveHandle, const std::string& filePath) {
     HANDLE fileHandle;
-    bool attempt = SFileOpenFileEx(mHandle, filePath.c_str(), 0, &fileHandle);
+    bool attempt = SFileOpenFileEx(archiveHandle, filePath.c_str(), 0, &fileHandle);
     if (!attempt) {
         SPDLOG_TRACE("({}) Failed to open file {} from mpq archive  {}.", GetLastError(), filePath, GetPath());
         return nullptr;
@@ -36,6 +69,7 @@ std::shared_ptr<File> OtrArchive::LoadFile(const std::string& filePath) {
     DWORD fileSize = SFileGetFileSize(fileHandle, 0);
     if (fileSize == 0) {
         SPDLOG_TRACE("({}) Failed to load file {}; filesize 0", GetLastError(), filePath, GetPath());
+        SFileCloseFile(fileHandle);
         return nullptr;
     }
     DWORD readBytes;
@@ -62,9 +96,33 @@ std::shared_ptr<File> OtrArchive::LoadFile(const std::string& filePath) {
     return fileToLoad;
 }
 
+std::shared_ptr<File> OtrArchive::LoadFile(const std::string& filePath) {
+    // Checks the open state under the pool lock, so loads may race with Close().
+    HANDLE archiveHandle = GetMpqHandle();
+    if (archiveHandle == nullptr) {
+        SPDLOG_TRACE("Failed to open file {} from mpq archive {}. Archive not open.", filePath, GetPath());
+        return nullptr;
+    }
+
+    auto fileToLoad = ReadFile(archiveHandle, filePath);
+    ReleaseMpqHandle(archiveHandle);
+    return fileToLoad;
+}
+
 std::shared_ptr<File> OtrArchive::LoadFile(uint64_t hash) {
-    const std::string& filePath = *mResourceManager->GetArchiveManager()->HashToString(hash);
-    return LoadFile(filePath);
+    // The index is filled in Open() and read-only afterwards, so this needs neither a lock nor the ArchiveManager.
+    const auto hashes = ListFiles();
+    auto it = hashes->find(hash);
+    if (it == hashes->end()) {
+        SPDLOG_TRACE("Failed to find file with hash {:X} in mpq archive {}.", hash, GetPath());
+        return nullptr;
+    }
+
+    return LoadFile(it->second);
+}
+
+bool OtrArchive::SupportsConcurrentStreaming() const {
+    return true;
 }
 
 bool OtrArchive::Open() {
@@ -77,9 +135,18 @@ bool OtrArchive::Open() {
         return false;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(mPoolMutex);
+        mIsOpen = true;
+    }
+
     // Generate the file list by reading the list file.
     // This can also be done via the StormLib API, but this was copied from the LUS1.x implementation in GenerateCrcMap.
-    auto listFile = LoadFile("(listfile)");
+    auto listFile = ReadFile(mHandle, "(listfile)");
+    if (listFile == nullptr) {
+        SPDLOG_ERROR("Failed to read the list file of mpq file \"{}\"", GetPath());
+        return opened;
+    }
 
     // Use std::string_view to avoid unnecessary string copies
     std::vector<std::string_view> lines =
@@ -97,10 +164,30 @@ bool OtrArchive::Open() {
 }
 
 bool OtrArchive::Close() {
-    bool closed = SFileCloseArchive(mHandle);
-    if (!closed) {
-        SPDLOG_ERROR("({}) Failed to close mpq {}", GetLastError(), mHandle);
+    bool closed = true;
+
+    {
+        // Handles still lent out are closed by ReleaseMpqHandle() once they come back.
+        std::lock_guard<std::mutex> lock(mPoolMutex);
+        mIsOpen = false;
+    }
+
+    if (mHandle != nullptr) {
+        closed = SFileCloseArchive(mHandle);
+        if (!closed) {
+            SPDLOG_ERROR("({}) Failed to close mpq {}", GetLastError(), GetPath());
+        }
+        mHandle = nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mPoolMutex);
+    for (HANDLE handle : mMpqHandlePool) {
+        if (!SFileCloseArchive(handle)) {
+            SPDLOG_ERROR("({}) Failed to close pooled mpq handle {}", GetLastError(), GetPath());
+            closed = false;
+        }
     }
+    mMpqHandlePool.clear();
 
     return closed;
 }
@@ -5,7 +5,15 @@
 #include "ship/resource/ResourceManager.h"
 #include "ship/resource/archive/Archive.h"
 #include "ship/resource/File.h"
+#include "ship/thread/ThreadPool.h"
+#include "ship/utils/StringHelper.h"
 #include "spdlog/spdlog.h"
+#include <monocypher.h>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <future>
+#include <map>
 #include <optional>
 #include <sstream>
 #include <string_view>
@@ -14,6 +22,10 @@
 #include <queue>
 #include <unordered_map>
 
+#ifndef LUS_TCC_VERSION
+#define LUS_TCC_VERSION "unknown"
+#endif
+
 namespace Ship {
 std::optional<std::vector<uint8_t>> LoadFromO2R(const std::string& path,
                                                 const std::shared_ptr<Archive>& archive = nullptr) {
@@ -75,24 +87,100 @@ constexpr std::string_view GetPlatform() {
 #endif
 }
 
-void ScriptLoader::Compile(const std::shared_ptr<Archive>& archive) {
+constexpr std::string_view GetModuleExtension() {
+#if defined(_WIN32) || defined(_WIN64)
+    return ".dll";
+#elif defined(__APPLE__)
+    return ".dylib";
+#else
+    return ".so";
+#endif
+}
+
+// Length-prefixes every field so that adjacent fields can never alias each other.
+static void HashField(crypto_blake2b_ctx* ctx, const void* data, size_t size) {
+    const uint64_t length = size;
+    crypto_blake2b_update(ctx, reinterpret_cast<const uint8_t*>(&length), sizeof(length));
+    crypto_blake2b_update(ctx, static_cast<const uint8_t*>(data), size);
+}
+
+static void HashField(crypto_blake2b_ctx* ctx, std::string_view value) {
+    HashField(ctx, value.data(), value.size());
+}
+
+static void ConfigureCompiler(TCCState* s, const std::unordered_map<std::string, std::string>& compileDefines,
+                              const std::string& buildOptions, const std::vector<std::string>& includePaths,
+                              const std::vector<std::string>& libraryPaths, const std::vector<std::string>& libraries) {
+    tcc_set_error_func(s, nullptr, [](void* opaque, const char* msg) {
+        std::string_view sv(msg);
+        if (sv.find("warning") != std::string_view::npos) {
+            SPDLOG_WARN("Compiler: {}", msg);
+        } else if (sv.find("error") != std::string_view::npos || sv.find("fatal") != std::string_view::npos) {
+            SPDLOG_ERROR("Compiler: {}", msg);
+        } else {
+            SPDLOG_INFO("Compiler: {}", msg);
+        }
+    });
+
+    tcc_define_symbol(s, "__DLL__", "1");
+
+    for (const auto& [key, value] : compileDefines) {
+        tcc_define_symbol(s, key.c_str(), value.c_str());
+    }
+
+    tcc_set_options(s, buildOptions.c_str());
+    tcc_set_output_type(s, TCC_OUTPUT_DLL);
+
+    for (const std::string& includePath : includePaths) {
+        if (!std::filesystem::exists(includePath)) {
+            SPDLOG_WARN("Include path does not exist: {}", includePath);
+            continue;
+        }
+
+        if (!std::filesystem::is_directory(includePath)) {
+            SPDLOG_WARN("Include path is not a directory: {}", includePath);
+            continue;
+        }
+
+        tcc_add_include_path(s, includePath.c_str());
+    }
+
+    for (const std::string& libraryPath : libraryPaths) {
+        if (!std::filesystem::exists(libraryPath)) {
+            SPDLOG_WARN("Library path does not exist: {}", libraryPath);
+            continue;
+        }
+
+        if (!std::filesystem::is_directory(libraryPath)) {
+            SPDLOG_WARN("Library path is not a directory: {}", libraryPath);
+            continue;
+        }
+
+        tcc_add_library_path(s, libraryPath.c_str());
+    }
+
+    for (const std::string& library : libraries) {
+        tcc_add_library(s, library.c_str());
+    }
+}
+
+bool ScriptLoader::CanCompile(const std::shared_ptr<Archive>& archive) const {
     const ArchiveManifest& info = archive->GetManifest();
-    constexpr std::string_view platform = GetPlatform();
     const bool isCodeMod = !info.Main.empty() || !info.Binaries.empty();
 
     if (mSafeLevel == SafeLevel::DISABLE_SCRIPTS) {
         SPDLOG_WARN("Script loading is disabled. Skipping script from archive: {}", archive->GetPath());
-        return;
+        return false;
     }
 
     if (!isCodeMod) {
-        return;
+        return false;
     }
 
     if (info.CodeVersion != mCodeVersion) {
         SPDLOG_ERROR("Incompatible code version for archive {}: expected {}, got {}", archive->GetPath(), mCodeVersion,
                      info.CodeVersion);
-        return;
+        return false;
     }
 
     const bool isTrusted = archive->IsSigned() && archive->IsChecksumValid();
@@ -114,7 +202,12 @@ void ScriptLoader::Compile(const std::shared_ptr<Archive>& archive) {
         }
     }
 
-    mLoadedArchives.push_back(archive);
+    return true;
+}
+
+std::string ScriptLoader::BuildModule(const std::shared_ptr<Archive>& archive) const {
+    const ArchiveManifest& info = archive->GetManifest();
+    constexpr std::string_view platform = GetPlatform();
 
     Scripting::LibraryLoader loader;
 
@@ -129,110 +222,137 @@ void ScriptLoader::Compile(const std::shared_ptr<Archive>& archive) {
         }
 
         loader.WriteToTempFile(*data);
-    } else if (!info.Main.empty()) {
-        const auto data = LoadFromO2R(info.Main, archive);
-        if (!data.has_value()) {
-            throw std::runtime_error("Failed to load main script: " + info.Main);
-        }
+        return temp;
+    }
 
-        TCCState* s = tcc_new();
-        if (!s) {
-            throw std::runtime_error("Failed to create TCCState");
-        }
+    if (info.Main.empty()) {
+        return temp;
+    }
 
-        tcc_set_error_func(s, nullptr, [](void* opaque, const char* msg) {
-            std::string_view sv(msg);
-            if (sv.find("warning") != std::string_view::npos) {
-                SPDLOG_WARN("Compiler: {}", msg);
-            } else if (sv.find("error") != std::string_view::npos || sv.find("fatal") != std::string_view::npos) {
-                SPDLOG_ERROR("Compiler: {}", msg);
-            } else {
-                SPDLOG_INFO("Compiler: {}", msg);
-            }
-        });
+    const auto mainFile = archive->LoadFile(info.Main);
+    if (mainFile == nullptr || !mainFile->IsLoaded) {
+        throw std::runtime_error("Failed to load main script: " + info.Main);
+    }
 
-        tcc_define_symbol(s, "__DLL__", "1");
+    // Read every listed source up front; they are both the cache key and the compiler input.
+    std::vector<std::pair<std::string, std::shared_ptr<File>>> sources;
+    std::istringstream stream(std::string(mainFile->Buffer->begin(), mainFile->Buffer->end()));
+    std::string line;
 
-        for (const auto& [key, value] : mCompileDefines) {
-            tcc_define_symbol(s, key.c_str(), value.c_str());
+    while (std::getline(stream, line)) {
+        if (line.empty()) {
+            continue;
         }
 
-        tcc_set_options(s, mBuildOptions.c_str());
-        tcc_set_output_type(s, TCC_OUTPUT_DLL);
-
-        for (const std::string& includePath : mIncludePaths) {
-            if (!std::filesystem::exists(includePath)) {
-                SPDLOG_WARN("Include path does not exist: {}", includePath);
-                continue;
-            }
-
-            if (!std::filesystem::is_directory(includePath)) {
-                SPDLOG_WARN("Include path is not a directory: {}", includePath);
-                continue;
-            }
+        line.erase(line.find_last_not_of(" \r\n\t") + 1);
+        line.erase(0, line.find_first_not_of(" \r\n\t"));
 
-            tcc_add_include_path(s, includePath.c_str());
+        if (line.empty() || line[0] == '#') {
+            continue;
         }
 
-        for (const std::string& libraryPath : mLibraryPaths) {
-            if (!std::filesystem::exists(libraryPath)) {
-                SPDLOG_WARN("Library path does not exist: {}", libraryPath);
-                continue;
-            }
+        auto file = archive->LoadFile(line);
+        if (file == nullptr || !file->IsLoaded) {
+            SPDLOG_ERROR("Failed to load script file: {}", line);
+            throw std::runtime_error("Failed to load script file: '" + line + "'");
+        }
+        sources.emplace_back(line, std::move(file));
+    }
 
-            if (!std::filesystem::is_directory(libraryPath)) {
-                SPDLOG_WARN("Library path is not a directory: {}", libraryPath);
-                continue;
+    std::filesystem::path cachePath;
+    if (!mCacheDirectory.empty()) {
+        crypto_blake2b_ctx ctx;
+        crypto_blake2b_init(&ctx, 32);
+        HashField(&ctx, LUS_TCC_VERSION);
+        HashField(&ctx, platform);
+        HashField(&ctx, std::to_string(mCodeVersion));
+        HashField(&ctx, mBuildOptions);
+        // unordered_map iteration order is unspecified, so hash the defines sorted
+        const std::map<std::string, std::string> defines(mCompileDefines.begin(), mCompileDefines.end());
+        for (const auto& [key, value] : defines) {
+            HashField(&ctx, key);
+            HashField(&ctx, value);
+        }
+        for (const auto* list : { &mIncludePaths, &mLibraryPaths, &mLibraries }) {
+            HashField(&ctx, std::to_string(list->size()));
+            for (const std::string& entry : *list) {
+                HashField(&ctx, entry);
             }
-
-            tcc_add_library_path(s, libraryPath.c_str());
+        }
+        HashField(&ctx, info.Name);
+        for (const auto& [path, file] : sources) {
+            HashField(&ctx, path);
+            HashField(&ctx, file->Buffer->data(), file->Buffer->size());
         }
 
-        for (const std::string& library : mLibraries) {
-            tcc_add_library(s, library.c_str());
+        uint8_t hash[32];
+        crypto_blake2b_final(&ctx, hash);
+        cachePath = std::filesystem::path(mCacheDirectory) /
+                    (StringHelper::BytesToHex(std::vector<unsigned char>(hash, hash + sizeof(hash))) +
+                     std::string(GetModuleExtension()));
+
+        std::error_code ec;
+        if (std::filesystem::exists(cachePath, ec) &&
+            std::filesystem::copy_file(cachePath, temp, std::filesystem::copy_options::overwrite_existing, ec)) {
+            SPDLOG_INFO("Using cached build of script {}", info.Name);
+            return temp;
         }
+    }
 
-        const std::vector<uint8_t>& raw = data.value();
-        std::string content(raw.begin(), raw.end());
-        std::istringstream stream(content);
-        std::string line;
+    TCCState* s = tcc_new();
+    if (!s) {
+        throw std::runtime_error("Failed to create TCCState");
+    }
 
-        while (std::getline(stream, line)) {
-            if (line.empty()) {
-                continue;
-            }
+    ConfigureCompiler(s, mCompileDefines, mBuildOptions, mIncludePaths, mLibraryPaths, mLibraries);
 
-            line.erase(line.find_last_not_of(" \r\n\t") + 1);
-            line.erase(0, line.find_first_not_of(" \r\n\t"));
+    for (const auto& [path, file] : sources) {
+        std::string sourceCode = "#line 1 \"[" + info.Name + "]:" + path + "\"\n";
+        sourceCode.append(file->Buffer->begin(), file->Buffer->end());
+        if (tcc_compile_string(s, sourceCode.c_str()) == -1) {
+            tcc_delete(s);
+            throw std::runtime_error("TCC Error in " + path);
+        }
+    }
 
-            if (line.empty() || line[0] == '#') {
-                continue;
-            }
+    if (tcc_output_file(s, temp.c_str()) == -1) {
+        tcc_delete(s);
+        throw std::runtime_error("Failed to output compiled code for " + temp);
+    }
+    tcc_delete(s);
+
+    if (!cachePath.empty()) {
+        // Write under a unique name and rename into place so a concurrent reader never sees a partial module.
+        std::error_code ec;
+        std::filesystem::create_directories(cachePath.parent_path(), ec);
+        const std::filesystem::path staging =
+            cachePath.string() + "." + std::filesystem::path(temp).filename().string() + ".tmp";
+        if (std::filesystem::copy_file(temp, staging, std::filesystem::copy_options::overwrite_existing, ec)) {
+            std::filesystem::rename(staging, cachePath, ec);
+        }
+        if (ec) {
+            SPDLOG_WARN("Failed to cache compiled script {}: {}", info.Name, ec.message());
+            std::filesystem::remove(staging, ec);
+        }
+    }
 
-            std::string safePath = line;
+    return temp;
+}
 
-            auto buf = LoadFromO2R(safePath, archive);
-            if (!buf.has_value()) {
-                tcc_delete(s);
-                throw std::runtime_error("Failed to load script file: '" + safePath + "'");
-            }
+void ScriptLoader::RegisterModule(const std::shared_ptr<Archive>& archive, const std::string& path) {
+    mLoadedArchives.push_back(archive);
 
-            std::string lineFixer = "#line 1 \"[" + info.Name + "]:" + safePath + "\"\n";
-            std::string sourceCode = lineFixer + std::string(buf->begin(), buf->end());
-            if (tcc_compile_string(s, sourceCode.c_str()) == -1) {
-                tcc_delete(s);
-                throw std::runtime_error("TCC Error in " + safePath);
-            }
-        }
+    Scripting::LibraryLoader loader;
+    loader.Init(path);
+    mLoadedScripts[archive->GetManifest().Name] = loader;
+}
 
-        if (tcc_output_file(s, temp.c_str()) == -1) {
-            tcc_delete(s);
-            throw std::runtime_error("Failed to output compiled code for " + temp);
-        }
+void ScriptLoader::Compile(const std::shared_ptr<Archive>& archive) {
+    if (!CanCompile(archive)) {
+        return;
     }
 
-    loader.Init(temp);
-    mLoadedScripts[info.Name] = loader;
+    RegisterModule(archive, BuildModule(archive));
 };
 
 void ScriptLoader::CompileAll(const std::optional<std::function<void(const std::shared_ptr<Archive>&)>>& preCallback,
@@ -240,20 +360,69 @@ void ScriptLoader::CompileAll(const std::optional<std::function<void(const std::
     auto archive = mResourceManager->GetArchiveManager();
     auto list = archive->GetArchives();
 
+    // Validate serially so SafeLevel errors surface before any work is queued.
+    std::vector<std::pair<std::shared_ptr<Archive>, bool>> codeMods;
     for (const auto& entry : *list) {
         const auto& info = entry->GetManifest();
         if (info.Main.empty() && info.Binaries.empty()) {
             continue;
         }
 
+        codeMods.emplace_back(entry, CanCompile(entry));
+    }
+
+    // Archives do not depend on each other until init, so every module can be built at once.
+    std::vector<std::future<std::string>> builds;
+    for (const auto& [entry, canCompile] : codeMods) {
+        if (!canCompile) {
+            builds.emplace_back();
+        } else if (mThreadPool != nullptr) {
+            builds.push_back(mThreadPool->Get()->submit_task([this, entry]() { return BuildModule(entry); }));
+        } else {
+            builds.push_back(std::async(std::launch::deferred, [this, entry]() { return BuildModule(entry); }));
+        }
+    }
+
+    std::exception_ptr error;
+    for (size_t i = 0; i < codeMods.size(); i++) {
+        if (!builds[i].valid()) {
+            continue;
+        }
+
+        // Keep draining after a failure so no build is still running when we return. Deferred builds have
+        // not started, so they are dropped instead of being compiled only to delete the result.
+        if (error != nullptr) {
+            if (builds[i].wait_for(std::chrono::seconds(0)) == std::future_status::deferred) {
+                continue;
+            }
+            try {
+                std::filesystem::remove(builds[i].get());
+            } catch (...) {
+            }
+            continue;
+        }
+
         if (preCallback.has_value()) {
-            preCallback.value()(entry);
+            preCallback.value()(codeMods[i].first);
+        }
+        try {
+            RegisterModule(codeMods[i].first, builds[i].get());
+        } catch (...) {
+            error = std::current_exception();
+            continue;
         }
-        Compile(entry);
         if (postCallback.has_value()) {
             postCallback.value()();
         }
     }
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ScriptLoader::SetCacheDirectory(const std::string& path) {
+    mCacheDirectory = path;
 }
 
 std::vector<std::string> ScriptLoader::GetLoadersInDependencyOrder() const {
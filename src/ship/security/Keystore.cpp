@@ -18,12 +18,15 @@ Keystore::Keystore(std::shared_ptr<Config> config) : Component("Keystore"), mCon
 }
 
 bool Keystore::AddKey(const std::string& keyName, const std::vector<uint8_t>& keyData, KeyOrigin origin) {
+    UnindexKey(keyName);
     mKeys[keyName] = KeystoreEntry{ keyName, keyData, origin };
+    IndexKey(keyName);
     Save();
     return true;
 }
 
 bool Keystore::RemoveKey(const std::string& keyName) {
+    UnindexKey(keyName);
     bool result = mKeys.erase(keyName) > 0;
     if (result) {
         Save();
@@ -32,12 +35,44 @@ bool Keystore::RemoveKey(const std::string& keyName) {
 }
 
 bool Keystore::HasKey(const std::vector<uint8_t>& keyData) const {
-    for (const auto& [keyName, entry] : mKeys) {
-        if (entry.Data == keyData) {
-            return true;
+    return mKeyIds.count(std::string(keyData.begin(), keyData.end())) > 0;
+}
+
+bool Keystore::FindKey(const std::vector<uint8_t>& keyData, KeystoreEntry& entry) const {
+    auto id = mKeyIds.find(std::string(keyData.begin(), keyData.end()));
+    if (id == mKeyIds.end()) {
+        return false;
+    }
+
+    entry = mKeys.at(id->second);
+    return true;
+}
+
+void Keystore::IndexKey(const std::string& keyName) {
+    const auto& data = mKeys.at(keyName).Data;
+    mKeyIds.try_emplace(std::string(data.begin(), data.end()), keyName);
+}
+
+void Keystore::UnindexKey(const std::string& keyName) {
+    auto it = mKeys.find(keyName);
+    if (it == mKeys.end()) {
+        return;
+    }
+
+    const std::string id(it->second.Data.begin(), it->second.Data.end());
+    auto indexed = mKeyIds.find(id);
+    if (indexed == mKeyIds.end() || indexed->second != keyName) {
+        return;
+    }
+
+    // another name may hold the same bytes; keep the id resolvable through it
+    mKeyIds.erase(indexed);
+    for (const auto& [otherName, other] : mKeys) {
+        if (otherName != keyName && other.Data == it->second.Data) {
+            mKeyIds.emplace(id, otherName);
+            break;
         }
     }
-    return false;
 }
 
 std::vector<KeystoreEntry> Keystore::GetKey(const std::string& keyName) const {
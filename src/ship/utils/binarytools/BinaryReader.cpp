@@ -5,14 +5,17 @@
 
 Ship::BinaryReader::BinaryReader(char* nBuffer, size_t nBufferSize) {
     mStream = std::make_shared<MemoryStream>(nBuffer, nBufferSize);
+    mMemoryStream = static_cast<MemoryStream*>(mStream.get());
 }
 
 Ship::BinaryReader::BinaryReader(Stream* nStream) {
     mStream.reset(nStream);
+    mMemoryStream = dynamic_cast<MemoryStream*>(nStream);
 }
 
 Ship::BinaryReader::BinaryReader(std::shared_ptr<Stream> nStream) {
     mStream = nStream;
+    mMemoryStream = dynamic_cast<MemoryStream*>(mStream.get());
 }
 
 void Ship::BinaryReader::Close() {
@@ -40,106 +43,47 @@ void Ship::BinaryReader::Read(int32_t length) {
 }
 
 void Ship::BinaryReader::Read(char* buffer, int32_t length) {
-    mStream->Read(buffer, length);
+    ReadBytes(buffer, length);
 }
 
 char Ship::BinaryReader::ReadChar() {
-    return (char)mStream->ReadByte();
+    return ReadValue<char>();
 }
 
 int8_t Ship::BinaryReader::ReadInt8() {
-    return mStream->ReadByte();
+    return ReadValue<int8_t>();
 }
 
 int16_t Ship::BinaryReader::ReadInt16() {
-    int16_t result = 0;
-    mStream->Read((char*)&result, sizeof(int16_t));
-    if (mEndianness != Endianness::Native) {
-        result = BSWAP16(result);
-    }
-
-    return result;
+    return ReadValue<int16_t>();
 }
 
 int32_t Ship::BinaryReader::ReadInt32() {
-    int32_t result = 0;
-
-    mStream->Read((char*)&result, sizeof(int32_t));
-
-    if (mEndianness != Endianness::Native) {
-        result = BSWAP32(result);
-    }
-
-    return result;
+    return ReadValue<int32_t>();
 }
 
 int64_t Ship::BinaryReader::ReadInt64() {
-    int64_t result = 0;
-
-    mStream->Read((char*)&result, sizeof(int64_t));
-
-    if (mEndianness != Endianness::Native) {
-        result = BSWAP64(result);
-    }
-
-    return result;
+    return ReadValue<int64_t>();
 }
 
 uint8_t Ship::BinaryReader::ReadUByte() {
-    return (uint8_t)mStream->ReadByte();
+    return ReadValue<uint8_t>();
 }
 
 uint16_t Ship::BinaryReader::ReadUInt16() {
-    uint16_t result = 0;
-
-    mStream->Read((char*)&result, sizeof(uint16_t));
-
-    if (mEndianness != Endianness::Native) {
-        result = BSWAP16(result);
-    }
-
-    return result;
+    return ReadValue<uint16_t>();
 }
 
 uint32_t Ship::BinaryReader::ReadUInt32() {
-    uint32_t result = 0;
-
-    mStream->Read((char*)&result, sizeof(uint32_t));
-
-    if (mEndianness != Endianness::Native) {
-        result = BSWAP32(result);
-    }
-
-    return result;
+    return ReadValue<uint32_t>();
 }
 
 uint64_t Ship::BinaryReader::ReadUInt64() {
-    uint64_t result = 0;
-
-    mStream->Read((char*)&result, sizeof(uint64_t));
-
-    if (mEndianness != Endianness::Native) {
-        result = BSWAP64(result);
-    }
-
-    return result;
+    return ReadValue<uint64_t>();
 }
 
 float Ship::BinaryReader::ReadFloat() {
-    float result = NAN;
-
-    mStream->Read((char*)&result, sizeof(float));
-
-    if (mEndianness != Endianness::Native) {
-        float tmp;
-        char* dst = (char*)&tmp;
-        char* src = (char*)&result;
-        dst[3] = src[0];
-        dst[2] = src[1];
-        dst[1] = src[2];
-        dst[0] = src[3];
-        result = tmp;
-    }
+    const float result = ReadValue<float>();
 
     if (std::isnan(result)) {
         throw std::runtime_error("BinaryReader::ReadFloat(): Error reading stream");
@@ -149,24 +93,7 @@ float Ship::BinaryReader::ReadFloat() {
 }
 
 double Ship::BinaryReader::ReadDouble() {
-    double result = NAN;
-
-    mStream->Read((char*)&result, sizeof(double));
-
-    if (mEndianness != Endianness::Native) {
-        double tmp;
-        char* dst = (char*)&tmp;
-        char* src = (char*)&result;
-        dst[7] = src[0];
-        dst[6] = src[1];
-        dst[5] = src[2];
-        dst[4] = src[3];
-        dst[3] = src[4];
-        dst[2] = src[5];
-        dst[1] = src[6];
-        dst[0] = src[7];
-        result = tmp;
-    }
+    const double result = ReadValue<double>();
 
     if (std::isnan(result)) {
         throw std::runtime_error("BinaryReader::ReadDouble(): Error reading stream");
@@ -178,8 +105,9 @@ double Ship::BinaryReader::ReadDouble() {
 std::string Ship::BinaryReader::ReadString() {
     std::string res;
     int numChars = ReadInt32();
-    for (int i = 0; i < numChars; i++) {
-        res += ReadChar();
+    if (numChars > 0) {
+        res.resize(numChars);
+        ReadBytes(res.data(), numChars);
     }
     return res;
 }
@@ -6,6 +6,8 @@
 #include "ship/window/gui/Gui.h"
 #include "ship/utils/StringHelper.h"
 #include "ship/utils/Utils.h"
+#include <algorithm>
+#include <iterator>
 #include <sstream>
 
 namespace Ship {
@@ -416,8 +418,9 @@ void ConsoleWindow::DrawElement() {
     }
 
     if (ImGui::BeginPopupContextWindow("Context Menu")) {
-        if (ImGui::MenuItem("Copy Text")) {
-            ImGui::SetClipboardText(mLog[mCurrentChannel][mSelectedId].Text.c_str());
+        const auto& channel = GetChannel(mCurrentChannel);
+        if (ImGui::MenuItem("Copy Text") && mSelectedId >= 0 && channel.Lines.Contains(mSelectedId)) {
+            ImGui::SetClipboardText(channel.Lines.GetText(mSelectedId));
             mSelectedId = -1;
         }
         ImGui::EndPopup();
@@ -428,17 +431,18 @@ void ConsoleWindow::DrawElement() {
 
     // Renders top bar filters
     if (ImGui::Button("Clear")) {
-        ClearLogs(mCurrentChannel);
+        ClearLogs(GetCurrentChannel());
     }
 
     if (mConsoleVariables->GetInteger("gSinkEnabled", 0)) {
         ImGui::SameLine();
         ImGui::SetNextItemWidth(150);
-        if (ImGui::BeginCombo("##channel", mCurrentChannel.c_str())) {
+        if (ImGui::BeginCombo("##channel", GetChannel(mCurrentChannel).Name.c_str())) {
             for (const auto& channel : mLogChannels) {
-                const bool isSelected = (channel == std::string(mCurrentChannel));
+                const uint32_t channelId = GetChannelId(channel);
+                const bool isSelected = channelId == mCurrentChannel;
                 if (ImGui::Selectable(channel.c_str(), isSelected)) {
-                    mCurrentChannel = channel;
+                    mCurrentChannel = channelId;
                 }
                 if (isSelected) {
                     ImGui::SetItemDefaultFocus();
@@ -447,12 +451,12 @@ void ConsoleWindow::DrawElement() {
             ImGui::EndCombo();
         }
     } else {
-        mCurrentChannel = "Console";
+        mCurrentChannel = gConsoleChannelId;
     }
     ImGui::SameLine();
     ImGui::SetNextItemWidth(150);
 
-    if (mCurrentChannel != "Console") {
+    if (mCurrentChannel != gConsoleChannelId) {
         if (ImGui::BeginCombo("##level", spdlog::level::to_string_view(mLevelFilter).data())) {
             for (const auto& priorityFilter : mPriorityFilters) {
                 const bool isSelected = priorityFilter == mLevelFilter;
@@ -482,46 +486,54 @@ void ConsoleWindow::DrawElement() {
     ImGui::PushStyleColor(ImGuiCol_FrameBgActive, ImVec4(.3f, .3f, .3f, 1.0f));
     if (ImGui::BeginTable("History", 1)) {
         bool focused = ImGui::IsWindowFocused(ImGuiFocusedFlags_ChildWindows);
-        const std::vector<ConsoleLine> channel = mLog[mCurrentChannel];
-
-        if (focused && ImGui::IsKeyPressed(ImGuiKey_DownArrow)) {
-            if (mSelectedId < (int32_t)channel.size() - 1) {
-                ++mSelectedId;
-            }
-        }
-        if (focused && ImGui::IsKeyPressed(ImGuiKey_UpArrow)) {
-            if (mSelectedId > 0) {
-                --mSelectedId;
+        auto& channel = GetChannel(mCurrentChannel);
+        RefreshVisibleLines(channel);
+        const auto& visible = channel.Visible;
+
+        // arrow keys step through the lines that are currently shown
+        const bool down = focused && ImGui::IsKeyPressed(ImGuiKey_DownArrow);
+        const bool up = focused && ImGui::IsKeyPressed(ImGuiKey_UpArrow);
+        if (down && mSelectedId < 0 && !visible.empty()) {
+            mSelectedId = static_cast<int64_t>(visible.front());
+        } else if ((down || up) && mSelectedId >= 0) {
+            auto it = std::lower_bound(visible.begin(), visible.end(), static_cast<uint64_t>(mSelectedId));
+            const bool onVisibleLine = it != visible.end() && *it == static_cast<uint64_t>(mSelectedId);
+            if (down && it != visible.end()) {
+                auto next = onVisibleLine ? std::next(it) : it;
+                if (next != visible.end()) {
+                    mSelectedId = static_cast<int64_t>(*next);
+                }
+            } else if (up && it != visible.begin()) {
+                mSelectedId = static_cast<int64_t>(*std::prev(it));
             }
         }
 
-        for (size_t i = 0; i < channel.size(); i++) {
-            ConsoleLine line = channel[i];
-            if (!mFilter.empty() && line.Text.find(mFilter) == std::string::npos) {
-                continue;
-            }
-            if (mLevelFilter > line.Priority) {
-                continue;
-            }
-            std::string id = line.Text + "##" + std::to_string(i);
-            ImGui::TableNextRow();
-            ImGui::TableSetColumnIndex(0);
-            const bool isSelected =
-                (mSelectedId == (int32_t)i) ||
-                std::find(mSelectedEntries.begin(), mSelectedEntries.end(), i) != mSelectedEntries.end();
-            ImGui::PushStyleColor(ImGuiCol_Text, mPriorityColours[line.Priority]);
-            if (ImGui::Selectable(id.c_str(), isSelected)) {
-                if (ImGui::IsKeyDown(ImGuiKey_LeftCtrl) && !isSelected) {
-                    mSelectedEntries.push_back(i);
-
-                } else {
-                    mSelectedEntries.clear();
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(visible.size()));
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+                const uint64_t seq = visible[row];
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                const bool isSelected =
+                    (mSelectedId == static_cast<int64_t>(seq)) ||
+                    std::find(mSelectedEntries.begin(), mSelectedEntries.end(), seq) != mSelectedEntries.end();
+                ImGui::PushID(static_cast<int>(seq));
+                ImGui::PushStyleColor(ImGuiCol_Text, mPriorityColours[channel.Lines.GetPriority(seq)]);
+                if (ImGui::Selectable(channel.Lines.GetText(seq), isSelected)) {
+                    if (ImGui::IsKeyDown(ImGuiKey_LeftCtrl) && !isSelected) {
+                        mSelectedEntries.push_back(seq);
+
+                    } else {
+                        mSelectedEntries.clear();
+                    }
+                    mSelectedId = isSelected ? -1 : static_cast<int64_t>(seq);
+                }
+                ImGui::PopStyleColor();
+                ImGui::PopID();
+                if (isSelected) {
+                    ImGui::SetItemDefaultFocus();
                 }
-                mSelectedId = isSelected ? -1 : i;
-            }
-            ImGui::PopStyleColor();
-            if (isSelected) {
-                ImGui::SetItemDefaultFocus();
             }
         }
         ImGui::EndTable();
@@ -532,7 +544,7 @@ void ConsoleWindow::DrawElement() {
     }
     ImGui::EndChild();
 
-    if (mCurrentChannel == "Console") {
+    if (mCurrentChannel == gConsoleChannelId) {
         // Renders input textfield
         constexpr ImGuiInputTextFlags flags = ImGuiInputTextFlags_EnterReturnsTrue | ImGuiInputTextFlags_CallbackEdit |
                                               ImGuiInputTextFlags_CallbackCompletion |
@@ -682,24 +694,77 @@ int ConsoleWindow::CallbackStub(ImGuiInputTextCallbackData* data) {
 
 void ConsoleWindow::Append(const std::string& channel, spdlog::level::level_enum priority, const char* fmt,
                            va_list args) {
-    // Determine the size of the formatted string
-    va_list argsCopy;
-    va_copy(argsCopy, args);
-    int size = vsnprintf(nullptr, 0, fmt, argsCopy);
-    va_end(argsCopy);
+    AppendToChannel(GetChannelId(channel), priority, fmt, args);
+}
 
-    if (size < 0) {
+void ConsoleWindow::AppendToChannel(uint32_t channelId, spdlog::level::level_enum priority, const char* fmt,
+                                    va_list args) {
+    auto& log = GetChannel(channelId);
+    const uint64_t seq = log.Lines.AppendV(priority, fmt, args);
+    if (!log.Lines.Contains(seq)) {
         SPDLOG_ERROR("Error during formatting.");
         SendErrorMessage("There has been an error during formatting!");
         return;
     }
 
-    std::vector<char> buf(size + 1);
-    vsnprintf(buf.data(), buf.size(), fmt, args);
+    // the arena may have evicted several old lines to fit this one
+    while (!log.Visible.empty() && log.Visible.front() < log.Lines.FirstSeq()) {
+        log.Visible.pop_front();
+    }
+    if (log.FilterValid && LinePassesFilter(log.Lines, seq, log.FilterText, log.FilterLevel)) {
+        log.Visible.push_back(seq);
+    }
+}
+
+uint32_t ConsoleWindow::GetChannelId(const std::string& channel) {
+    if (mChannels.empty()) {
+        for (const auto& name : mLogChannels) {
+            mChannels.emplace_back().Name = name;
+        }
+    }
+
+    for (size_t i = 0; i < mChannels.size(); i++) {
+        if (mChannels[i].Name == channel) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+    mChannels.emplace_back().Name = channel;
+    return static_cast<uint32_t>(mChannels.size() - 1);
+}
+
+ConsoleWindow::ConsoleChannel& ConsoleWindow::GetChannel(uint32_t channelId) {
+    if (mChannels.empty()) {
+        GetChannelId(mLogChannels.front());
+    }
+    return mChannels[channelId];
+}
 
-    buf[buf.size() - 1] = 0;
-    // Do not copy the null terminator into the std::string
-    mLog[channel].push_back({ std::string(buf.begin(), buf.end() - 1), priority });
+void ConsoleWindow::ResetChannel(ConsoleChannel& channel) {
+    channel.Lines.Clear();
+    channel.Visible.clear();
+    channel.FilterValid = false;
+}
+
+bool ConsoleWindow::LinePassesFilter(const LogLineArena& lines, uint64_t seq, const std::string& text,
+                                     spdlog::level::level_enum level) {
+    return level <= lines.GetPriority(seq) &&
+           (text.empty() || lines.GetTextView(seq).find(text) != std::string_view::npos);
+}
+
+void ConsoleWindow::RefreshVisibleLines(ConsoleChannel& channel) {
+    if (channel.FilterValid && channel.FilterText == mFilter && channel.FilterLevel == mLevelFilter) {
+        return;
+    }
+
+    channel.FilterText = mFilter;
+    channel.FilterLevel = mLevelFilter;
+    channel.FilterValid = true;
+    channel.Visible.clear();
+    for (uint64_t seq = channel.Lines.FirstSeq(); seq < channel.Lines.NextSeq(); seq++) {
+        if (LinePassesFilter(channel.Lines, seq, channel.FilterText, channel.FilterLevel)) {
+            channel.Visible.push_back(seq);
+        }
+    }
 }
 
 void ConsoleWindow::Append(const std::string& channel, spdlog::level::level_enum priority, const char* fmt, ...) {
@@ -712,41 +777,41 @@ void ConsoleWindow::Append(const std::string& channel, spdlog::level::level_enum
 void ConsoleWindow::SendInfoMessage(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    Append("Console", spdlog::level::info, fmt, args);
+    AppendToChannel(gConsoleChannelId, spdlog::level::info, fmt, args);
     va_end(args);
 }
 
 void ConsoleWindow::SendErrorMessage(const char* fmt, ...) {
     va_list args;
     va_start(args, fmt);
-    Append("Console", spdlog::level::err, fmt, args);
+    AppendToChannel(gConsoleChannelId, spdlog::level::err, fmt, args);
     va_end(args);
 }
 
 void ConsoleWindow::SendInfoMessage(const std::string& str) {
-    Append("Console", spdlog::level::info, str.c_str());
+    Append("Console", spdlog::level::info, "%s", str.c_str());
 }
 
 void ConsoleWindow::SendErrorMessage(const std::string& str) {
-    Append("Console", spdlog::level::err, str.c_str());
+    Append("Console", spdlog::level::err, "%s", str.c_str());
 }
 
 void ConsoleWindow::ClearLogs(std::string channel) {
-    mLog[channel].clear();
+    ResetChannel(GetChannel(GetChannelId(channel)));
     mSelectedEntries.clear();
     mSelectedId = -1;
 }
 
 void ConsoleWindow::ClearLogs() {
-    for (auto [key, var] : mLog) {
-        var.clear();
+    for (auto& channel : mChannels) {
+        ResetChannel(channel);
     }
     mSelectedEntries.clear();
     mSelectedId = -1;
 }
 
 std::string ConsoleWindow::GetCurrentChannel() {
-    return mCurrentChannel;
+    return GetChannel(mCurrentChannel).Name;
 }
 
 void ConsoleWindow::ClearBindings() {
@@ -1,6 +1,7 @@
 #include "ship/window/gui/StatsWindow.h"
 #include <imgui.h>
 #include "spdlog/spdlog.h"
+#include "ship/core/Context.h"
 
 namespace Ship {
 StatsWindow::~StatsWindow() {
@@ -9,6 +10,9 @@ StatsWindow::~StatsWindow() {
 
 void StatsWindow::OnInit(const nlohmann::json& initArgs) {
     GuiWindow::OnInit(initArgs);
+    if (auto context = GetContext()) {
+        mResourceManager = context->GetChildren().GetFirst<ResourceManager>();
+    }
 }
 
 void StatsWindow::DrawElement() {
@@ -30,9 +34,23 @@ void StatsWindow::DrawElement() {
     ImGui::Text("Platform: Unknown");
 #endif
     ImGui::Text("Status: %0.3f ms/frame (%0.1f FPS)", deltatime * 1000.0f, framerate);
+    if (mResourceManager != nullptr) {
+        constexpr double kMiB = 1024.0 * 1024.0;
+        if (mCacheStats.Budget != 0) {
+            ImGui::Text("Resources: %zu (%0.1f / %0.1f MiB)", mCacheStats.Resources, mCacheStats.Bytes / kMiB,
+                        mCacheStats.Budget / kMiB);
+        } else {
+            ImGui::Text("Resources: %zu (%0.1f MiB)", mCacheStats.Resources, mCacheStats.Bytes / kMiB);
+        }
+        ImGui::Text("Evicted: %llu (%0.1f MiB)", static_cast<unsigned long long>(mCacheStats.Evictions),
+                    mCacheStats.EvictedBytes / kMiB);
+    }
     ImGui::PopStyleColor();
 }
 
 void StatsWindow::UpdateElement() {
+    if (mResourceManager != nullptr) {
+        mCacheStats = mResourceManager->GetCacheStats();
+    }
 }
 } // namespace Ship
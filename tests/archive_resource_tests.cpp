@@ -1,9 +1,10 @@
 #include <gtest/gtest.h>
+#include <cstring>
 #include <functional>
-#include <filesystem>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -11,10 +12,12 @@
 #include "ship/resource/File.h"
 #include "ship/resource/Resource.h"
 #include "ship/resource/ResourceManager.h"
+#include "ship/resource/ResourceType.h"
 #include "ship/resource/archive/Archive.h"
 #include "ship/resource/archive/ArchiveManager.h"
 #include "ship/resource/type/Blob.h"
 #include "ship/utils/StrHash64.h"
+#include "temp_directory.h"
 
 // ============================================================
 // TestRamArchive — in-memory archive that does not require Context
@@ -31,6 +34,7 @@ class TestRamArchive final : public Ship::Archive {
     }
 
     bool Open() override {
+        OpenCount++;
         for (const auto& [path, _] : mTestFiles) {
             IndexFile(path);
         }
@@ -70,6 +74,8 @@ class TestRamArchive final : public Ship::Archive {
         return nullptr;
     }
 
+    size_t OpenCount = 0;
+
   private:
     std::unordered_map<std::string, std::string> mTestFiles;
     std::string mManifestJson;
@@ -90,47 +96,22 @@ std::shared_ptr<TestRamArchive> LoadedArchive(const std::string& path,
     return archive;
 }
 
-class TempDirectoryArchive {
-  public:
-    explicit TempDirectoryArchive(const std::unordered_map<std::string, std::string>& files = {}) {
-        static size_t sCounter = 0;
-        mPath = std::filesystem::temp_directory_path() / ("lus_resource_manager_test_" + std::to_string(sCounter++));
-        std::filesystem::create_directories(mPath);
-        WriteTextFile("manifest.json", R"({"name":"TempArchive","code_version":1})");
-        for (const auto& [path, content] : files) {
-            WriteTextFile(path, content);
-        }
-    }
-
-    ~TempDirectoryArchive() {
-        std::error_code ec;
-        std::filesystem::remove_all(mPath, ec);
-    }
-
-    const std::filesystem::path& GetPath() const {
-        return mPath;
-    }
-
-  private:
-    std::filesystem::path mPath;
-
-    void WriteTextFile(const std::string& relativePath, const std::string& content) {
-        const auto filePath = mPath / relativePath;
-        std::filesystem::create_directories(filePath.parent_path());
-        std::ofstream out(filePath, std::ios::binary);
-        out << content;
-    }
-};
-
 struct ResourceManagerHarness {
     explicit ResourceManagerHarness(const std::unordered_map<std::string, std::string>& files = {})
-        : archive(files), threadPool(std::make_shared<Ship::ThreadPool>(1)),
+        : archive("resource_manager_test_" + std::to_string(sCounter++)),
+          threadPool(std::make_shared<Ship::ThreadPool>(1)),
           manager(std::make_shared<Ship::ResourceManager>(threadPool)) {
+        archive.WriteFile("manifest.json", R"({"name":"TempArchive","code_version":1})");
+        for (const auto& [path, content] : files) {
+            archive.WriteFile(path, content);
+        }
         manager->Init({ { "archivePaths", std::vector<std::string>{ archive.GetPath().string() } },
                         { "validHashes", std::vector<uint32_t>{} } });
     }
 
-    TempDirectoryArchive archive;
+    static inline size_t sCounter = 0;
+
+    TempDirectory archive;
     std::shared_ptr<Ship::ThreadPool> threadPool;
     std::shared_ptr<Ship::ResourceManager> manager;
 };
@@ -300,6 +281,56 @@ TEST(ArchiveManager, ListFilesWithIncludeExclude) {
     EXPECT_EQ(files->at(0), "textures/hero.bin");
 }
 
+TEST(ArchiveManager, ListFilesMatchesWildcardTailAfterPrefix) {
+    auto archive = LoadedArchive("ram://test", {
+                                                   { "textures/area_1/wall.bin", "a" },
+                                                   { "textures/area_12/wall.bin", "b" },
+                                                   { "textures/area_12/floor.bin", "c" },
+                                                   { "textures/area_2/wall.bin", "d" },
+                                                   { "audio/area_12/theme.bin", "e" },
+                                               });
+    Ship::ArchiveManager am;
+    am.AddArchive(archive);
+
+    EXPECT_EQ(*am.ListFiles("textures/area_1?/*"),
+              (std::vector<std::string>{ "textures/area_12/floor.bin", "textures/area_12/wall.bin" }));
+    EXPECT_EQ(*am.ListFiles("*/area_12/*.bin"),
+              (std::vector<std::string>{ "audio/area_12/theme.bin", "textures/area_12/floor.bin",
+                                         "textures/area_12/wall.bin" }));
+    EXPECT_EQ(*am.ListFiles("textures/area_2/wall.bin"), std::vector<std::string>{ "textures/area_2/wall.bin" });
+}
+
+TEST(ArchiveManager, ListFilesDeduplicatesOverlappingIncludes) {
+    auto archive = LoadedArchive("ram://test", { { "textures/hero.bin", "a" }, { "textures/villain.bin", "b" } });
+    Ship::ArchiveManager am;
+    am.AddArchive(archive);
+
+    EXPECT_EQ(*am.ListFiles({ "textures/*", "*hero*" }, {}),
+              (std::vector<std::string>{ "textures/hero.bin", "textures/villain.bin" }));
+}
+
+TEST(ArchiveManager, ListFilesWithPrefixReturnsSortedRange) {
+    auto base = LoadedArchive("ram://base", { { "textures/b.bin", "b" }, { "audio/a.bin", "a" } });
+    auto mod = LoadedArchive("ram://mod", { { "textures/a.bin", "a" }, { "textures/b.bin", "b2" } });
+    Ship::ArchiveManager am;
+    am.AddArchive(base);
+    am.AddArchive(mod);
+
+    auto textures = am.ListFilesWithPrefix("textures/");
+    EXPECT_EQ(std::vector<std::string_view>(textures.begin(), textures.end()),
+              (std::vector<std::string_view>{ "textures/a.bin", "textures/b.bin" }));
+    EXPECT_EQ(am.ListFilesWithPrefix("").size(), 3u);
+    EXPECT_TRUE(am.ListFilesWithPrefix("models/").empty());
+
+    am.RemoveArchive(mod);
+    textures = am.ListFilesWithPrefix("textures/");
+    EXPECT_EQ(std::vector<std::string_view>(textures.begin(), textures.end()),
+              (std::vector<std::string_view>{ "textures/b.bin" }));
+
+    ASSERT_TRUE(am.WriteFile(base, "textures/c.bin", { 0x01 }));
+    EXPECT_EQ(am.ListFilesWithPrefix("textures/").size(), 2u);
+}
+
 TEST(ArchiveManager, ListDirectoriesFindsDirectories) {
     auto archive = LoadedArchive("ram://test", {
                                                    { "textures/hero.bin", "a" },
@@ -403,6 +434,60 @@ TEST(ArchiveManager, FilesUnavailableAfterArchiveRemoved) {
     EXPECT_FALSE(am.HasFile("important.bin"));
 }
 
+TEST(ArchiveManager, RemovingOverrideFallsBackToLowerArchive) {
+    auto base = LoadedArchive("ram://base", { { "shared.bin", "base" }, { "textures/base.bin", "b" } });
+    auto mod = LoadedArchive("ram://mod", { { "shared.bin", "mod" }, { "textures/mod/only.bin", "m" } });
+    Ship::ArchiveManager am;
+    am.AddArchive(base);
+    am.AddArchive(mod);
+    ASSERT_EQ(am.GetArchiveFromFile("shared.bin"), mod);
+
+    am.RemoveArchive(mod);
+    EXPECT_EQ(am.GetArchiveFromFile("shared.bin"), base);
+    auto file = am.LoadFile("shared.bin");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(std::string(file->Buffer->begin(), file->Buffer->end()), "base");
+    EXPECT_FALSE(am.HasFile("textures/mod/only.bin"));
+    EXPECT_EQ(am.HashToString(CRC64("textures/mod/only.bin")), nullptr);
+    EXPECT_EQ(*am.ListDirectories("*"), std::vector<std::string>{ "textures" });
+}
+
+TEST(ArchiveManager, RemovingLowerArchiveKeepsOverride) {
+    auto base = LoadedArchive("ram://base", { { "shared.bin", "base" } });
+    auto mod = LoadedArchive("ram://mod", { { "shared.bin", "mod" } });
+    Ship::ArchiveManager am;
+    am.AddArchive(base);
+    am.AddArchive(mod);
+
+    am.RemoveArchive(base);
+    EXPECT_EQ(am.GetArchiveFromFile("shared.bin"), mod);
+    am.RemoveArchive(mod);
+    EXPECT_FALSE(am.HasFile("shared.bin"));
+}
+
+TEST(ArchiveManager, RemovingArchiveDoesNotReopenOthers) {
+    auto base = LoadedArchive("ram://base", { { "a.bin", "a" } });
+    auto mod = LoadedArchive("ram://mod", { { "b.bin", "b" } });
+    Ship::ArchiveManager am;
+    am.AddArchive(base);
+    am.AddArchive(mod);
+
+    am.RemoveArchive(mod);
+    EXPECT_EQ(base->OpenCount, 1u);
+    EXPECT_TRUE(am.HasFile("a.bin"));
+}
+
+TEST(ArchiveManager, AddingSameArchiveTwiceIsNoOp) {
+    auto archive = LoadedArchive("ram://test", { { "a.bin", "a" } });
+    Ship::ArchiveManager am;
+    am.AddArchive(archive);
+    EXPECT_EQ(am.AddArchive(archive), archive);
+    EXPECT_EQ(am.GetArchives()->size(), 1u);
+
+    am.RemoveArchive(archive);
+    EXPECT_FALSE(am.HasFile("a.bin"));
+}
+
 // ============================================================
 // ArchiveManager — GameVersion validation
 // ============================================================
@@ -798,6 +883,240 @@ TEST(ResourceManager, UnloadResourceByIdentifierIsNoOp) {
     EXPECT_NO_THROW(rm.UnloadResource(id));
 }
 
+// ============================================================
+// ResourceManager — cache budget and LRU eviction
+// ============================================================
+
+namespace {
+// A binary Json resource of exactly `size` bytes: a 64-byte OTR header followed by a padded document.
+std::string JsonResourceFile(size_t size) {
+    std::string file(OTR_HEADER_SIZE, '\0');
+    const uint32_t type = static_cast<uint32_t>(Ship::ResourceType::Json);
+    memcpy(file.data() + 4, &type, sizeof(type));
+    file += R"({"v":1})";
+    file.resize(size, ' ');
+    return file;
+}
+} // anonymous namespace
+
+TEST(ResourceManager, CacheStatsTrackLoadedBytes) {
+    ResourceManagerHarness harness({ { "a", JsonResourceFile(100) }, { "b", JsonResourceFile(150) } });
+    auto& rm = *harness.manager;
+
+    ASSERT_NE(rm.LoadResource("a"), nullptr);
+    ASSERT_NE(rm.LoadResource("b"), nullptr);
+    auto stats = rm.GetCacheStats();
+    EXPECT_EQ(stats.Resources, 2u);
+    EXPECT_EQ(stats.Bytes, 250u);
+
+    rm.UnloadResource("a");
+    EXPECT_EQ(rm.GetCacheStats().Bytes, 150u);
+}
+
+TEST(ResourceManager, EvictToBudgetIsNoOpWithoutBudget) {
+    ResourceManagerHarness harness({ { "a", JsonResourceFile(100) } });
+    auto& rm = *harness.manager;
+
+    ASSERT_NE(rm.LoadResource("a"), nullptr);
+    EXPECT_EQ(rm.EvictToBudget(), 0u);
+    EXPECT_NE(rm.GetCachedResource("a"), nullptr);
+}
+
+TEST(ResourceManager, EvictToBudgetDropsLeastRecentlyUsedFirst) {
+    ResourceManagerHarness harness(
+        { { "a", JsonResourceFile(100) }, { "b", JsonResourceFile(100) }, { "c", JsonResourceFile(100) } });
+    auto& rm = *harness.manager;
+    rm.SetCacheBudget(250);
+
+    ASSERT_NE(rm.LoadResource("a"), nullptr);
+    ASSERT_NE(rm.LoadResource("b"), nullptr);
+    ASSERT_NE(rm.LoadResource("c"), nullptr);
+    // A cache hit makes "a" the most recently used, leaving "b" as the oldest.
+    ASSERT_NE(rm.GetCachedResource("a"), nullptr);
+
+    std::vector<void*> evicted;
+    EXPECT_EQ(rm.EvictToBudget([&](Ship::IResource& resource) { evicted.push_back(resource.GetRawPointer()); }), 1u);
+    EXPECT_EQ(evicted.size(), 1u);
+
+    auto stats = rm.GetCacheStats();
+    EXPECT_EQ(stats.Bytes, 200u);
+    EXPECT_EQ(stats.Evictions, 1u);
+    EXPECT_EQ(stats.EvictedBytes, 100u);
+    EXPECT_NE(rm.GetCachedResource("a"), nullptr);
+    EXPECT_EQ(rm.GetCachedResource("b"), nullptr);
+    EXPECT_NE(rm.GetCachedResource("c"), nullptr);
+}
+
+TEST(ResourceManager, EvictToBudgetKeepsReferencedResources) {
+    ResourceManagerHarness harness({ { "a", JsonResourceFile(100) }, { "b", JsonResourceFile(100) } });
+    auto& rm = *harness.manager;
+    rm.SetCacheBudget(50);
+
+    auto held = rm.LoadResource("a");
+    ASSERT_NE(held, nullptr);
+    ASSERT_NE(rm.LoadResource("b"), nullptr);
+
+    EXPECT_EQ(rm.EvictToBudget(), 1u);
+    EXPECT_EQ(rm.GetCachedResource("a"), held);
+    EXPECT_EQ(rm.GetCachedResource("b"), nullptr);
+    EXPECT_EQ(rm.GetCacheStats().Bytes, 100u);
+
+    // Once the last outside reference is gone the resource can go too.
+    held.reset();
+    EXPECT_EQ(rm.EvictToBudget(), 1u);
+    EXPECT_EQ(rm.GetCacheStats().Resources, 0u);
+}
+
+TEST(ResourceManager, EvictedResourceReloadsOnDemand) {
+    ResourceManagerHarness harness({ { "a", JsonResourceFile(100) } });
+    auto& rm = *harness.manager;
+    rm.SetCacheBudget(1);
+
+    ASSERT_NE(rm.LoadResource("a"), nullptr);
+    ASSERT_EQ(rm.EvictToBudget(), 1u);
+    EXPECT_NE(rm.LoadResource("a"), nullptr);
+    EXPECT_EQ(rm.GetCacheStats().Resources, 1u);
+}
+
+TEST(ResourceManager, ArchiveOverrideDirtiesOnlyAffectedResources) {
+    ResourceManagerHarness harness({ { "a", JsonResourceFile(100) }, { "b", JsonResourceFile(100) } });
+    auto& rm = *harness.manager;
+    auto untouched = rm.LoadResource("b");
+    ASSERT_NE(rm.LoadResource("a"), nullptr);
+    ASSERT_NE(untouched, nullptr);
+
+    auto mod = LoadedArchive("ram://mod", { { "a", JsonResourceFile(200) } });
+    rm.GetArchiveManager()->AddArchive(mod);
+    EXPECT_EQ(rm.GetCachedResource("a"), nullptr);
+    EXPECT_EQ(rm.GetCachedResource("b"), untouched);
+    ASSERT_NE(rm.LoadResource("a"), nullptr);
+    EXPECT_EQ(rm.GetCacheStats().Bytes, 300u);
+
+    rm.GetArchiveManager()->RemoveArchive(mod);
+    EXPECT_EQ(rm.GetCachedResource("a"), nullptr);
+    EXPECT_EQ(rm.GetCachedResource("b"), untouched);
+    ASSERT_NE(rm.LoadResource("a"), nullptr);
+    EXPECT_EQ(rm.GetCacheStats().Bytes, 200u);
+}
+
+TEST(ResourceManager, AddedArchiveResolvesPreviouslyMissingResource) {
+    ResourceManagerHarness harness;
+    auto& rm = *harness.manager;
+    ASSERT_EQ(rm.LoadResource("late"), nullptr);
+
+    rm.GetArchiveManager()->AddArchive(LoadedArchive("ram://mod", { { "late", JsonResourceFile(100) } }));
+    EXPECT_NE(rm.LoadResource("late"), nullptr);
+}
+
+// ============================================================
+// ResourceManager — access manifest prefetching
+// ============================================================
+
+TEST(ResourceManager, LoadsWithoutManifestAreDemandLoads) {
+    ResourceManagerHarness harness(
+        { { "a", JsonResourceFile(100) }, { "b", JsonResourceFile(100) }, { "c", JsonResourceFile(100) } });
+    auto& rm = *harness.manager;
+
+    rm.EnterScene("area");
+    for (const char* path : { "a", "b", "c" }) {
+        ASSERT_NE(rm.LoadResource(path), nullptr);
+    }
+
+    auto stats = rm.GetCacheStats();
+    EXPECT_EQ(stats.DemandLoads, 3u);
+    EXPECT_EQ(stats.PrefetchLoads, 0u);
+}
+
+TEST(ResourceManager, RecordedManifestListsFirstAccessesPerScene) {
+    ResourceManagerHarness harness(
+        { { "a", JsonResourceFile(100) }, { "b", JsonResourceFile(100) }, { "c", JsonResourceFile(100) } });
+    auto& rm = *harness.manager;
+    const auto manifestPath = (harness.archive.GetPath() / "access.json").string();
+
+    rm.SetAccessRecording(true);
+    rm.EnterScene("title");
+    ASSERT_NE(rm.LoadResource("b"), nullptr);
+    ASSERT_NE(rm.LoadResource("a"), nullptr);
+    ASSERT_NE(rm.LoadResource("b"), nullptr);
+    rm.EnterScene("area");
+    ASSERT_NE(rm.LoadResource("c"), nullptr);
+    ASSERT_NE(rm.LoadResource(CRC64("a")), nullptr);
+    ASSERT_TRUE(rm.SaveAccessManifest(manifestPath));
+
+    std::ifstream in(manifestPath);
+    auto manifest = nlohmann::json::parse(in);
+    const auto pathEntry = [](const char* path) { return nlohmann::json({ { "kind", "path" }, { "path", path } }); };
+    EXPECT_EQ(manifest["version"], 2);
+    EXPECT_EQ(manifest["scenes"]["title"], nlohmann::json::array({ pathEntry("b"), pathEntry("a") }));
+    EXPECT_EQ(manifest["scenes"]["area"],
+              nlohmann::json::array({ pathEntry("c"), { { "kind", "hash" }, { "hash", CRC64("a") } } }));
+}
+
+TEST(ResourceManager, RecordedHashAccessesArePrefetchedOnReplay) {
+    const std::unordered_map<std::string, std::string> files = { { "a", JsonResourceFile(100) },
+                                                                 { "b", JsonResourceFile(100) } };
+    TempDirectory manifestDirectory("access_hash_replay");
+    const auto manifestPath = (manifestDirectory.GetPath() / "access.json").string();
+    {
+        ResourceManagerHarness recorder(files);
+        recorder.manager->SetAccessRecording(true);
+        recorder.manager->EnterScene("area");
+        ASSERT_NE(recorder.manager->LoadResource(CRC64("a")), nullptr);
+        ASSERT_NE(recorder.manager->LoadResource("b"), nullptr);
+        ASSERT_TRUE(recorder.manager->SaveAccessManifest(manifestPath));
+    }
+
+    ResourceManagerHarness harness(files);
+    auto& rm = *harness.manager;
+    ASSERT_TRUE(rm.LoadAccessManifest(manifestPath));
+
+    rm.EnterScene("area");
+    harness.threadPool->Get()->wait();
+    EXPECT_EQ(rm.GetCacheStats().PrefetchLoads, 2u);
+
+    // Both loads hit the entries the prefetch cached, under the same identifier kind they were recorded with.
+    ASSERT_NE(rm.LoadResource(CRC64("a")), nullptr);
+    ASSERT_NE(rm.LoadResource("b"), nullptr);
+    EXPECT_EQ(rm.GetCacheStats().DemandLoads, 0u);
+}
+
+TEST(ResourceManager, ReplayedManifestAvoidsDemandLoads) {
+    ResourceManagerHarness harness({ { "a", JsonResourceFile(100) },
+                                     { "b", JsonResourceFile(100) },
+                                     { "c", JsonResourceFile(100) },
+                                     { "d", JsonResourceFile(100) } });
+    auto& rm = *harness.manager;
+    const auto manifestPath = (harness.archive.GetPath() / "access.json").string();
+    {
+        std::ofstream out(manifestPath);
+        out << R"({"version":1,"scenes":{"area":["a","b","c"],"other":["d"]}})";
+    }
+    ASSERT_TRUE(rm.LoadAccessManifest(manifestPath));
+
+    rm.EnterScene("area");
+    harness.threadPool->Get()->wait();
+    EXPECT_EQ(rm.GetCacheStats().PrefetchLoads, 3u);
+
+    // "d" belongs to a scene that was never entered, so only it misses.
+    for (const char* path : { "a", "b", "c", "d" }) {
+        ASSERT_NE(rm.LoadResource(path), nullptr);
+    }
+    EXPECT_EQ(rm.GetCacheStats().DemandLoads, 1u);
+}
+
+TEST(ResourceManager, LoadAccessManifestRejectsMissingOrMalformedFiles) {
+    ResourceManagerHarness harness;
+    auto& rm = *harness.manager;
+    const auto manifestPath = (harness.archive.GetPath() / "access.json").string();
+
+    EXPECT_FALSE(rm.LoadAccessManifest(manifestPath));
+    {
+        std::ofstream out(manifestPath);
+        out << "not json";
+    }
+    EXPECT_FALSE(rm.LoadAccessManifest(manifestPath));
+}
+
 // ============================================================
 // ResourceFilter — construction
 // ============================================================
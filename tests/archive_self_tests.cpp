@@ -1,12 +1,23 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
+#include <monocypher.h>
+#include <monocypher-ed25519.h>
 
 #include "ship/resource/File.h"
+#include "ship/resource/ResourceManager.h"
 #include "ship/resource/archive/Archive.h"
+#include "ship/security/Keystore.h"
+#include "ship/thread/ThreadPool.h"
 #include "ship/utils/StrHash64.h"
+#include "ship/utils/StringHelper.h"
 
 // ============================================================
 // Minimal in-memory Archive for testing Archive's own methods
@@ -18,8 +29,12 @@ class TestArchive final : public Ship::Archive {
   public:
     explicit TestArchive(const std::string& path = "ram://arch",
                          const std::unordered_map<std::string, std::string>& files = {},
-                         const std::string& manifest = R"({"name":"TestArchive","code_version":1})")
-        : Ship::Archive(path), mFiles(files), mManifest(manifest) {
+                         const std::string& manifest = R"({"name":"TestArchive","code_version":1})",
+                         std::shared_ptr<Ship::Keystore> keystore = nullptr,
+                         std::shared_ptr<Ship::ResourceManager> resourceManager = nullptr,
+                         bool concurrentStreaming = false)
+        : Ship::Archive(path, std::move(resourceManager), std::move(keystore)), mFiles(files), mManifest(manifest),
+          mConcurrentStreaming(concurrentStreaming) {
     }
 
     bool Open() override {
@@ -54,9 +69,33 @@ class TestArchive final : public Ship::Archive {
         return nullptr;
     }
 
+    bool StreamFile(const std::string& filePath,
+                    const std::function<bool(const uint8_t* data, size_t size)>& consumer) override {
+        const int32_t active = ++mActiveStreams;
+        int32_t peak = mPeakStreams;
+        while (active > peak && !mPeakStreams.compare_exchange_weak(peak, active)) {
+        }
+        // Long enough for overlapping streams to be observed.
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        const bool streamed = Ship::Archive::StreamFile(filePath, consumer);
+        mActiveStreams--;
+        return streamed;
+    }
+
+    bool SupportsConcurrentStreaming() const override {
+        return mConcurrentStreaming;
+    }
+
+    int32_t GetPeakStreams() const {
+        return mPeakStreams;
+    }
+
   private:
     std::unordered_map<std::string, std::string> mFiles;
     std::string mManifest;
+    bool mConcurrentStreaming;
+    std::atomic<int32_t> mActiveStreams = 0;
+    std::atomic<int32_t> mPeakStreams = 0;
 
     static std::shared_ptr<Ship::File> Make(const std::string& content) {
         auto f = std::make_shared<Ship::File>();
@@ -225,3 +264,223 @@ TEST(Archive, IsChecksumValidFalseWhenNotSigned) {
     arch.Load();
     EXPECT_FALSE(arch.IsChecksumValid());
 }
+
+// ============================================================
+// Archive::ComputeChecksum
+// ============================================================
+
+namespace {
+
+std::vector<std::pair<std::string, std::string>> Sorted(const std::unordered_map<std::string, std::string>& files) {
+    std::vector<std::pair<std::string, std::string>> sorted(files.begin(), files.end());
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}
+
+std::vector<uint8_t> SequentialDigest(const std::unordered_map<std::string, std::string>& files) {
+    crypto_blake2b_ctx ctx;
+    crypto_blake2b_init(&ctx, 64);
+    for (const auto& [path, content] : Sorted(files)) {
+        crypto_blake2b_update(&ctx, reinterpret_cast<const uint8_t*>(path.data()), path.size());
+        crypto_blake2b_update(&ctx, reinterpret_cast<const uint8_t*>(content.data()), content.size());
+    }
+    std::vector<uint8_t> digest(64);
+    crypto_blake2b_final(&ctx, digest.data());
+    return digest;
+}
+
+std::vector<uint8_t> TreeDigest(const std::unordered_map<std::string, std::string>& files) {
+    std::vector<uint8_t> leaves;
+    for (const auto& [path, content] : Sorted(files)) {
+        std::string leafInput = path + '\0' + content;
+        uint8_t leaf[64];
+        crypto_blake2b(leaf, 64, reinterpret_cast<const uint8_t*>(leafInput.data()), leafInput.size());
+        leaves.insert(leaves.end(), leaf, leaf + 64);
+    }
+    std::vector<uint8_t> digest(64);
+    crypto_blake2b(digest.data(), 64, leaves.data(), leaves.size());
+    return digest;
+}
+
+const std::unordered_map<std::string, std::string> kSignedFiles = {
+    { "a.txt", "alpha" }, { "dir/b.bin", std::string("\x00\x01\x02", 3) }, { "z/last", "zulu" }
+};
+
+std::vector<uint8_t> Checksum(TestArchive& arch, uint32_t version) {
+    std::vector<uint8_t> checksum;
+    EXPECT_TRUE(arch.ComputeChecksum(version, checksum));
+    return checksum;
+}
+
+std::unordered_map<std::string, std::string> ManyFiles(int32_t count) {
+    std::unordered_map<std::string, std::string> files;
+    for (int32_t i = 0; i < count; i++) {
+        const size_t size = static_cast<size_t>(i) * 31 + 1;
+        files["file" + std::to_string(i)] = std::string(size, static_cast<char>('a' + i % 26));
+    }
+    return files;
+}
+
+} // anonymous namespace
+
+TEST(Archive, TreeChecksumMatchesPerFileDigests) {
+    TestArchive arch("ram://tree", kSignedFiles);
+    arch.Load();
+    EXPECT_EQ(Checksum(arch, 2), TreeDigest(kSignedFiles));
+}
+
+TEST(Archive, SequentialChecksumMatchesSingleDigest) {
+    TestArchive arch("ram://sequential", kSignedFiles);
+    arch.Load();
+    EXPECT_EQ(Checksum(arch, 1), SequentialDigest(kSignedFiles));
+}
+
+TEST(Archive, TreeChecksumChangesWithFileContents) {
+    auto tampered = kSignedFiles;
+    tampered["dir/b.bin"] = "changed";
+    TestArchive arch("ram://tree", tampered);
+    arch.Load();
+    EXPECT_NE(Checksum(arch, 2), TreeDigest(kSignedFiles));
+}
+
+TEST(Archive, ComputeChecksumRejectsUnknownVersion) {
+    TestArchive arch("ram://tree", kSignedFiles);
+    arch.Load();
+    std::vector<uint8_t> checksum;
+    EXPECT_FALSE(arch.ComputeChecksum(3, checksum));
+}
+
+TEST(Archive, TreeChecksumStreamsSequentiallyWithoutOptIn) {
+    const auto files = ManyFiles(16);
+    auto resourceManager = std::make_shared<Ship::ResourceManager>(std::make_shared<Ship::ThreadPool>(4));
+    TestArchive arch("ram://tree", files, R"({"name":"TestArchive","code_version":1})", nullptr, resourceManager);
+    arch.Load();
+    EXPECT_EQ(Checksum(arch, 2), TreeDigest(files));
+    EXPECT_EQ(arch.GetPeakStreams(), 1);
+}
+
+TEST(Archive, TreeChecksumUsesThreadPoolWhenArchiveOptsIn) {
+    const auto files = ManyFiles(32);
+    auto resourceManager = std::make_shared<Ship::ResourceManager>(std::make_shared<Ship::ThreadPool>(4));
+    TestArchive arch("ram://tree", files, R"({"name":"TestArchive","code_version":1})", nullptr, resourceManager,
+                     true);
+    arch.Load();
+    EXPECT_EQ(Checksum(arch, 2), TreeDigest(files));
+    EXPECT_GT(arch.GetPeakStreams(), 1);
+}
+
+TEST(Archive, TreeChecksumFinishesWhileThreadPoolIsBusy) {
+    const auto files = ManyFiles(8);
+    auto threadPool = std::make_shared<Ship::ThreadPool>(1);
+    auto resourceManager = std::make_shared<Ship::ResourceManager>(threadPool);
+    TestArchive arch("ram://tree", files, R"({"name":"TestArchive","code_version":1})", nullptr, resourceManager,
+                     true);
+    arch.Load();
+
+    // Occupy the only pool thread until the checksum is done; the validating thread must hash every leaf itself.
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto blocker = threadPool->Get()->submit_task([released]() { released.wait(); });
+
+    EXPECT_EQ(Checksum(arch, 2), TreeDigest(files));
+    release.set_value();
+    blocker.wait();
+}
+
+// ============================================================
+// Keystore::FindKey
+// ============================================================
+
+TEST(Keystore, FindKeyByKeyData) {
+    Ship::Keystore keystore;
+    const std::vector<uint8_t> data = { 1, 2, 3, 4 };
+    keystore.AddKey("first", data);
+
+    Ship::KeystoreEntry entry;
+    ASSERT_TRUE(keystore.FindKey(data, entry));
+    EXPECT_EQ(entry.Name, "first");
+    EXPECT_FALSE(keystore.FindKey({ 4, 3, 2, 1 }, entry));
+
+    // The id stays resolvable while another name still holds the same bytes.
+    keystore.AddKey("second", data);
+    keystore.RemoveKey("first");
+    ASSERT_TRUE(keystore.FindKey(data, entry));
+    EXPECT_EQ(entry.Name, "second");
+    keystore.RemoveKey("second");
+    EXPECT_FALSE(keystore.HasKey(data));
+}
+
+#ifdef ENABLE_SCRIPTING
+// ============================================================
+// Archive::Validate signature versions
+// ============================================================
+
+namespace {
+
+struct TestSigner {
+    uint8_t SecretKey[64];
+    uint8_t PublicKey[32];
+
+    TestSigner() {
+        uint8_t seed[32];
+        for (int i = 0; i < 32; i++) {
+            seed[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+        crypto_ed25519_key_pair(SecretKey, PublicKey, seed);
+    }
+
+    std::shared_ptr<Ship::Keystore> MakeKeystore() const {
+        auto keystore = std::make_shared<Ship::Keystore>();
+        keystore->AddKey("TestSigner", std::vector<uint8_t>(PublicKey, PublicKey + 32));
+        return keystore;
+    }
+
+    // Builds a manifest carrying the checksum and signature for the given digest.
+    std::string Manifest(const std::vector<uint8_t>& digest, int version) const {
+        std::vector<uint8_t> signature(64);
+        crypto_ed25519_sign(signature.data(), SecretKey, digest.data(), digest.size());
+        return std::string(R"({"name":"Signed","code_version":1,"signature_version":)") + std::to_string(version) +
+               R"(,"checksum":")" + StringHelper::BytesToHex(digest) + R"(","signature":")" +
+               StringHelper::BytesToHex(signature) + R"(","public_key":")" +
+               StringHelper::BytesToHex(std::vector<uint8_t>(PublicKey, PublicKey + 32)) + R"("})";
+    }
+};
+
+} // anonymous namespace
+
+TEST(Archive, TreeSignatureValidates) {
+    TestSigner signer;
+    TestArchive arch("ram://signed", kSignedFiles, signer.Manifest(TreeDigest(kSignedFiles), 2),
+                     signer.MakeKeystore());
+    arch.Load();
+    EXPECT_TRUE(arch.IsChecksumValid());
+    EXPECT_TRUE(arch.IsSigned());
+}
+
+TEST(Archive, TreeChecksumDetectsTamperedFile) {
+    TestSigner signer;
+    auto tampered = kSignedFiles;
+    tampered["dir/b.bin"] = "changed";
+    TestArchive arch("ram://signed", tampered, signer.Manifest(TreeDigest(kSignedFiles), 2), signer.MakeKeystore());
+    arch.Load();
+    EXPECT_FALSE(arch.IsChecksumValid());
+    EXPECT_FALSE(arch.IsSigned());
+}
+
+TEST(Archive, SequentialSignatureStillValidates) {
+    TestSigner signer;
+    TestArchive arch("ram://signed", kSignedFiles, signer.Manifest(SequentialDigest(kSignedFiles), 1),
+                     signer.MakeKeystore());
+    arch.Load();
+    EXPECT_TRUE(arch.IsChecksumValid());
+    EXPECT_TRUE(arch.IsSigned());
+}
+
+TEST(Archive, SignatureVersionsAreNotInterchangeable) {
+    TestSigner signer;
+    TestArchive arch("ram://signed", kSignedFiles, signer.Manifest(SequentialDigest(kSignedFiles), 2),
+                     signer.MakeKeystore());
+    arch.Load();
+    EXPECT_FALSE(arch.IsChecksumValid());
+}
+#endif // ENABLE_SCRIPTING
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "ship/audio/AudioRingBuffer.h"
+#include "ship/audio/NullAudioPlayer.h"
+
+using namespace Ship;
+
+// ============================================================
+// AudioRingBuffer
+// ============================================================
+
+TEST(AudioRingBuffer, CapacityRoundsUpToPowerOfTwo) {
+    AudioRingBuffer ring;
+    ring.Reset(1000, 4);
+    EXPECT_EQ(ring.Capacity(), 1024u);
+    EXPECT_EQ(ring.GetBytesPerFrame(), 4u);
+    EXPECT_EQ(ring.Size(), 0u);
+}
+
+TEST(AudioRingBuffer, PreservesOrderAcrossWrap) {
+    AudioRingBuffer ring;
+    ring.Reset(8, sizeof(int16_t));
+
+    std::vector<int16_t> in = { 1, 2, 3, 4, 5, 6 };
+    std::vector<int16_t> out(6, 0);
+    ASSERT_EQ(ring.Write(reinterpret_cast<uint8_t*>(in.data()), 6), 6u);
+    ASSERT_EQ(ring.Read(reinterpret_cast<uint8_t*>(out.data()), 4), 4u);
+
+    // This write straddles the end of the storage.
+    std::vector<int16_t> more = { 7, 8, 9, 10, 11 };
+    ASSERT_EQ(ring.Write(reinterpret_cast<uint8_t*>(more.data()), 5), 5u);
+    EXPECT_EQ(ring.Size(), 7u);
+
+    std::vector<int16_t> rest(7, 0);
+    ASSERT_EQ(ring.Read(reinterpret_cast<uint8_t*>(rest.data()), 7), 7u);
+    EXPECT_EQ(rest, (std::vector<int16_t>{ 5, 6, 7, 8, 9, 10, 11 }));
+}
+
+TEST(AudioRingBuffer, WriteStopsWhenFull) {
+    AudioRingBuffer ring;
+    ring.Reset(4, sizeof(int16_t));
+
+    std::vector<int16_t> in = { 1, 2, 3, 4, 5, 6 };
+    EXPECT_EQ(ring.Write(reinterpret_cast<uint8_t*>(in.data()), 6), 4u);
+    EXPECT_EQ(ring.Write(reinterpret_cast<uint8_t*>(in.data()), 1), 0u);
+    EXPECT_EQ(ring.Size(), 4u);
+}
+
+TEST(AudioRingBuffer, SingleProducerSingleConsumerKeepsSequence) {
+    constexpr uint32_t kFrames = 100000;
+    AudioRingBuffer ring;
+    ring.Reset(256, sizeof(uint32_t));
+
+    std::thread producer([&ring]() {
+        uint32_t next = 0;
+        uint32_t chunk[37];
+        while (next < kFrames) {
+            uint32_t count = 0;
+            while (count < 37 && next + count < kFrames) {
+                chunk[count] = next + count;
+                count++;
+            }
+            const size_t written = ring.Write(reinterpret_cast<uint8_t*>(chunk), count);
+            if (written == 0) {
+                std::this_thread::yield();
+            }
+            next += static_cast<uint32_t>(written);
+        }
+    });
+
+    uint32_t expected = 0;
+    bool inOrder = true;
+    uint32_t chunk[53];
+    while (expected < kFrames) {
+        const size_t read = ring.Read(reinterpret_cast<uint8_t*>(chunk), 53);
+        if (read == 0) {
+            std::this_thread::yield();
+        }
+        for (size_t i = 0; i < read; i++) {
+            inOrder = inOrder && chunk[i] == expected;
+            expected++;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(ring.Size(), 0u);
+}
+
+// ============================================================
+// AudioPlayer ring and adaptive buffering, driven through the
+// Null backend with an external clock so every step is deterministic.
+// ============================================================
+
+namespace {
+constexpr int32_t kSampleRate = 32000;
+constexpr size_t kStereoFrameBytes = 2 * sizeof(int16_t);
+
+std::unique_ptr<NullAudioPlayer> MakePlayer(int32_t desiredBuffered, bool adaptive = true) {
+    AudioSettings settings;
+    settings.SampleRate = kSampleRate;
+    settings.DesiredBuffered = desiredBuffered;
+    settings.AdaptiveBuffering = adaptive;
+    auto player = std::make_unique<NullAudioPlayer>(settings);
+    player->SetExternalClock(true);
+    EXPECT_TRUE(player->Init());
+    return player;
+}
+
+void PlayFrames(AudioPlayer& player, size_t frames) {
+    std::vector<uint8_t> buf(frames * kStereoFrameBytes, 0x11);
+    player.Play(buf.data(), buf.size());
+}
+} // namespace
+
+TEST(AudioPlayerRing, PlayQueuesIntoRing) {
+    auto player = MakePlayer(1024);
+    PlayFrames(*player, 500);
+    EXPECT_EQ(player->Buffered(), 500);
+    EXPECT_EQ(player->GetDroppedFrameCount(), 0u);
+}
+
+TEST(AudioPlayerRing, RenderWaitsForPrimingWithoutCountingUnderruns) {
+    auto player = MakePlayer(1024);
+    PlayFrames(*player, 512);
+
+    // Not primed yet: the device gets silence and nothing is consumed.
+    EXPECT_EQ(player->Render(256), 0u);
+    EXPECT_EQ(player->Buffered(), 512);
+    EXPECT_EQ(player->GetUnderrunCount(), 0u);
+
+    PlayFrames(*player, 512);
+    EXPECT_EQ(player->Render(256), 256u);
+    EXPECT_EQ(player->Buffered(), 768);
+}
+
+TEST(AudioPlayerRing, FullRingDropsAndCounts) {
+    auto player = MakePlayer(1024, false);
+    for (int i = 0; i < 20; i++) {
+        PlayFrames(*player, 512);
+    }
+    EXPECT_EQ(player->Buffered(), 8192);
+    EXPECT_EQ(player->GetDroppedFrameCount(), 20u * 512u - 8192u);
+}
+
+TEST(AudioPlayerRing, UnderrunGrowsDesiredBuffered) {
+    auto player = MakePlayer(1024);
+    PlayFrames(*player, 1024);
+    ASSERT_EQ(player->Render(256), 256u);
+
+    // Ask for more than is queued: short read, padded with silence.
+    EXPECT_EQ(player->Render(1024), 768u);
+    EXPECT_EQ(player->GetUnderrunCount(), 1u);
+    EXPECT_EQ(player->GetDevicePeriod(), 1024);
+
+    // The adaptation runs on the producer side, on the next Play().
+    PlayFrames(*player, 128);
+    EXPECT_EQ(player->GetDesiredBuffered(), 1024 + 1024);
+}
+
+TEST(AudioPlayerRing, CleanPlaybackShrinksTowardsTwoPeriods) {
+    constexpr size_t kPeriod = 256;
+    auto player = MakePlayer(2048);
+
+    // Keep the ring comfortably above the target while the device renders one period per game tick.
+    PlayFrames(*player, 4096);
+    for (int tick = 0; tick < kSampleRate * 60 / static_cast<int>(kPeriod); tick++) {
+        ASSERT_EQ(player->Render(kPeriod), kPeriod);
+        PlayFrames(*player, kPeriod);
+    }
+
+    EXPECT_EQ(player->GetUnderrunCount(), 0u);
+    EXPECT_EQ(player->GetDesiredBuffered(), static_cast<int32_t>(2 * kPeriod));
+}
+
+TEST(AudioPlayerRing, DropsShrinkDesiredBuffered) {
+    auto player = MakePlayer(4096);
+    player->Render(128);
+
+    // Overfill the ring, then let a full second of device time pass.
+    for (int i = 0; i < 20; i++) {
+        PlayFrames(*player, 512);
+    }
+    ASSERT_GT(player->GetDroppedFrameCount(), 0u);
+    for (int i = 0; i < kSampleRate / 128; i++) {
+        ASSERT_EQ(player->Render(128), 128u);
+        PlayFrames(*player, 128);
+    }
+
+    EXPECT_EQ(player->GetUnderrunCount(), 0u);
+    EXPECT_EQ(player->GetDesiredBuffered(), 4096 - 128);
+}
+
+TEST(AudioPlayerRing, AdaptiveBufferingCanBeDisabled) {
+    auto player = MakePlayer(1024, false);
+    PlayFrames(*player, 1024);
+    ASSERT_EQ(player->Render(512), 512u);
+    EXPECT_EQ(player->Render(1024), 512u);
+    PlayFrames(*player, 128);
+    EXPECT_EQ(player->GetUnderrunCount(), 1u);
+    EXPECT_EQ(player->GetDesiredBuffered(), 1024);
+}
+
+TEST(AudioPlayerRing, ChangingChannelsResetsRing) {
+    auto player = MakePlayer(1024);
+    PlayFrames(*player, 512);
+    ASSERT_TRUE(player->SetAudioChannels(AudioChannelsSetting::audioRaw51));
+    EXPECT_EQ(player->Buffered(), 0);
+
+    std::vector<uint8_t> surround(100 * 6 * sizeof(int16_t), 0);
+    player->Play(surround.data(), surround.size());
+    EXPECT_EQ(player->Buffered(), 100);
+}
@@ -410,3 +410,99 @@ TEST(BinaryEndianness, DoubleBigRoundTrip) {
     reader.SetEndianness(Ship::Endianness::Big);
     EXPECT_DOUBLE_EQ(reader.ReadDouble(), 2.718281828459045);
 }
+
+// ============================================================
+// Bulk reads
+// ============================================================
+
+TEST(BinaryReadArray, BigEndianInt16s) {
+    auto [stream, writer] = MakeWriter();
+    writer.SetEndianness(Ship::Endianness::Big);
+    for (int16_t value : { 1, -2, 0x1234, -32768, 7 }) {
+        writer.Write(value);
+    }
+    stream->Seek(0, Ship::SeekOffsetType::Start);
+    Ship::BinaryReader reader(stream);
+    reader.SetEndianness(Ship::Endianness::Big);
+    EXPECT_EQ(reader.ReadArray<int16_t>(5), (std::vector<int16_t>{ 1, -2, 0x1234, -32768, 7 }));
+    EXPECT_EQ(reader.GetBaseAddress(), 10u);
+}
+
+TEST(BinaryReadArray, MatchesSingleReads) {
+    auto [stream, writer] = MakeWriter();
+    writer.SetEndianness(Ship::Endianness::Big);
+    for (int32_t i = 0; i < 16; i++) {
+        writer.Write(static_cast<float>(i) * 0.5f);
+    }
+    stream->Seek(0, Ship::SeekOffsetType::Start);
+    Ship::BinaryReader reader(stream);
+    reader.SetEndianness(Ship::Endianness::Big);
+
+    float bulk[16];
+    reader.ReadArray(bulk, 16);
+    reader.Seek(0, Ship::SeekOffsetType::Start);
+    for (int32_t i = 0; i < 16; i++) {
+        EXPECT_FLOAT_EQ(bulk[i], reader.ReadFloat());
+    }
+}
+
+TEST(BinaryReadArray, NaNThrows) {
+    uint32_t nanBits = 0x7FC00000;
+    float nanFloat;
+    std::memcpy(&nanFloat, &nanBits, sizeof(float));
+
+    auto [stream, writer] = MakeWriter();
+    writer.Write(1.0f);
+    writer.Write(nanFloat);
+    stream->Seek(0, Ship::SeekOffsetType::Start);
+    Ship::BinaryReader reader(stream);
+    EXPECT_THROW(reader.ReadArray<float>(2), std::runtime_error);
+}
+
+TEST(BinaryReadArray, PastEndThrows) {
+    auto [stream, writer] = MakeWriter();
+    writer.Write(static_cast<int32_t>(1));
+    stream->Seek(0, Ship::SeekOffsetType::Start);
+    Ship::BinaryReader reader(stream);
+    EXPECT_THROW(reader.ReadArray<int32_t>(2), std::out_of_range);
+}
+
+namespace {
+struct PackedRecord {
+    int16_t A;
+    uint16_t B;
+    uint8_t C[4];
+    int32_t D;
+};
+using PackedRecordLayout = Ship::StructLayout<int16_t, uint16_t, uint8_t, uint8_t, uint8_t, uint8_t, int32_t>;
+} // namespace
+
+TEST(BinaryReadStruct, SwapsEachField) {
+    auto [stream, writer] = MakeWriter();
+    writer.SetEndianness(Ship::Endianness::Big);
+    for (int32_t i = 0; i < 3; i++) {
+        writer.Write(static_cast<int16_t>(-1 - i));
+        writer.Write(static_cast<uint16_t>(0xABCD));
+        writer.Write(static_cast<uint8_t>(1));
+        writer.Write(static_cast<uint8_t>(2));
+        writer.Write(static_cast<uint8_t>(3));
+        writer.Write(static_cast<uint8_t>(4));
+        writer.Write(static_cast<int32_t>(0x01020304 + i));
+    }
+    stream->Seek(0, Ship::SeekOffsetType::Start);
+    Ship::BinaryReader reader(stream);
+    reader.SetEndianness(Ship::Endianness::Big);
+
+    PackedRecord records[2];
+    reader.ReadStruct<PackedRecordLayout>(records, 2);
+    const PackedRecord last = reader.ReadStruct<PackedRecordLayout, PackedRecord>();
+
+    EXPECT_EQ(records[0].A, -1);
+    EXPECT_EQ(records[1].A, -2);
+    EXPECT_EQ(last.A, -3);
+    EXPECT_EQ(records[1].B, 0xABCD);
+    EXPECT_EQ(records[1].C[0], 1);
+    EXPECT_EQ(records[1].C[3], 4);
+    EXPECT_EQ(records[0].D, 0x01020304);
+    EXPECT_EQ(last.D, 0x01020306);
+}
@@ -57,5 +57,22 @@ TEST_F(ConnectedPhysicalDeviceManagerTest, RefreshPreservesHandleForConnectedGam
     EXPECT_EQ(SDL_GetGamepadFromID(detachedInstanceId), nullptr);
 }
 
+TEST_F(ConnectedPhysicalDeviceManagerTest, IgnoreListFiltersPortWithoutHidingGamepad) {
+    ConnectedPhysicalDeviceManager manager;
+    manager.RefreshConnectedSDLGamepads();
+
+    EXPECT_FALSE(manager.PortIsIgnoringInstanceId(3, mInstanceId));
+    manager.IgnoreInstanceIdForPort(1, mInstanceId);
+
+    EXPECT_TRUE(manager.PortIsIgnoringInstanceId(1, mInstanceId));
+    EXPECT_FALSE(manager.PortIsIgnoringInstanceId(0, mInstanceId));
+    EXPECT_FALSE(manager.GetConnectedSDLGamepadsForPort(1).contains(mInstanceId));
+    EXPECT_TRUE(manager.GetConnectedSDLGamepadsForPort(0).contains(mInstanceId));
+    EXPECT_TRUE(manager.GetConnectedSDLGamepads().contains(mInstanceId));
+
+    manager.UnignoreInstanceIdForPort(1, mInstanceId);
+    EXPECT_FALSE(manager.PortIsIgnoringInstanceId(1, mInstanceId));
+}
+
 } // namespace
 } // namespace Ship
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "ship/events/Events.h"
+#include "ship/events/EventTypes.h"
+
+using namespace Ship;
+
+// ============================================================
+// Allocation tracking
+//
+// Replaces the global allocation functions for the benchmark executable so the
+// benchmarks can assert that steady-state dispatch performs no heap traffic.
+// This file is built on its own (see CMakeLists.txt) so no other test runs
+// with the replacement, and counting is gated per thread so gtest's own
+// bookkeeping is not measured.
+// ============================================================
+
+namespace {
+thread_local bool gTrackAllocations = false;
+std::atomic<uint64_t> gAllocationCount{ 0 };
+uint64_t gListenerHits = 0;
+
+void CountingListener(IEvent* event) {
+    (void)event;
+    gListenerHits++;
+}
+
+struct AllocationScope {
+    AllocationScope() {
+        gAllocationCount.store(0, std::memory_order_relaxed);
+        gTrackAllocations = true;
+    }
+
+    ~AllocationScope() {
+        gTrackAllocations = false;
+    }
+
+    uint64_t Count() const {
+        return gAllocationCount.load(std::memory_order_relaxed);
+    }
+};
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (gTrackAllocations) {
+        gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// ============================================================
+// Events::CallEvent dispatch benchmarks
+//
+// Each benchmark registers N listeners on one event, warms the dispatch path
+// up once (the dispatch stack and caller-diagnostic entry allocate on first
+// use), then times a fixed number of dispatches and records ns/dispatch as a
+// test property.
+// ============================================================
+
+static void RunDispatchBenchmark(const int listenerCount) {
+    constexpr int kIterations = 100000;
+
+    Events events;
+    const EventID id = events.RegisterEvent("BenchmarkEvent");
+    for (int i = 0; i < listenerCount; i++) {
+        events.RegisterListener(id, CountingListener);
+    }
+
+    IEvent ev{ false };
+    events.CallEvent(id, &ev, "bench.cpp", 1, "bench.cpp:1");
+    gListenerHits = 0;
+
+    uint64_t allocations = 0;
+    const auto start = std::chrono::steady_clock::now();
+    {
+        AllocationScope scope;
+        for (int i = 0; i < kIterations; i++) {
+            events.CallEvent(id, &ev, "bench.cpp", 1, "bench.cpp:1");
+        }
+        allocations = scope.Count();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double nsPerDispatch = std::chrono::duration<double, std::nano>(end - start).count() / kIterations;
+    ::testing::Test::RecordProperty("ns_per_dispatch", std::to_string(nsPerDispatch));
+
+    EXPECT_EQ(gListenerHits, static_cast<uint64_t>(kIterations) * listenerCount);
+    EXPECT_EQ(allocations, 0u);
+}
+
+TEST(EventsBenchmark, DispatchOneListener) {
+    RunDispatchBenchmark(1);
+}
+
+TEST(EventsBenchmark, DispatchTenListeners) {
+    RunDispatchBenchmark(10);
+}
+
+TEST(EventsBenchmark, DispatchHundredListeners) {
+    RunDispatchBenchmark(100);
+}
@@ -121,3 +121,79 @@ TEST(EventsTest, GetEventRegistrationReturnsNullForUnknownId) {
     EXPECT_EQ(events.GetEventRegistration(-1), nullptr);
     EXPECT_EQ(events.GetEventRegistration(9999), nullptr);
 }
+
+// ============================================================
+// Listener arrays are copy-on-write
+//
+// Dispatch walks the immutable array published for the EventID. Registering
+// or unregistering publishes a new array instead of mutating the one a
+// dispatch may currently be iterating.
+// ============================================================
+
+namespace {
+Events* gMutatingEvents = nullptr;
+EventID gMutatingEventId = -1;
+ListenerID gVictimListener = -1;
+int gVictimHits = 0;
+
+void UnregisterVictimListener(IEvent* event) {
+    (void)event;
+    gMutatingEvents->UnregisterListener(gMutatingEventId, gVictimListener);
+}
+
+void VictimListener(IEvent* event) {
+    (void)event;
+    gVictimHits++;
+}
+} // namespace
+
+TEST(EventsListenerArrayTest, DispatchReusesPublishedArray) {
+    Events events;
+    EventID id = events.RegisterEvent("TestEvent");
+    events.RegisterListener(id, VictimListener);
+
+    auto first = events.GetActionList().Get(id);
+    auto second = events.GetActionList().Get(id);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(first->size(), 1u);
+}
+
+TEST(EventsListenerArrayTest, RegisterPublishesNewArrayAndKeepsOldSnapshot) {
+    Events events;
+    EventID id = events.RegisterEvent("TestEvent");
+    events.RegisterListener(id, VictimListener);
+
+    auto before = events.GetActionList().Get(id);
+    events.RegisterListener(id, VictimListener);
+    auto after = events.GetActionList().Get(id);
+
+    EXPECT_NE(before.get(), after.get());
+    EXPECT_EQ(before->size(), 1u);
+    EXPECT_EQ(after->size(), 2u);
+}
+
+TEST(EventsListenerArrayTest, UnregisterDuringDispatchIsSafe) {
+    Events events;
+    gMutatingEvents = &events;
+    gMutatingEventId = events.RegisterEvent("TestEvent");
+    gVictimHits = 0;
+
+    events.RegisterListener(gMutatingEventId, UnregisterVictimListener, EVENT_PRIORITY_LOW);
+    gVictimListener = events.RegisterListener(gMutatingEventId, VictimListener, EVENT_PRIORITY_HIGH);
+
+    IEvent ev{ false };
+    events.CallEvent(gMutatingEventId, &ev);
+    events.CallEvent(gMutatingEventId, &ev);
+
+    EXPECT_EQ(gVictimHits, 0);
+    EXPECT_EQ(events.GetEventRegistration(gMutatingEventId)->Listeners.size(), 1u);
+    EXPECT_EQ(events.GetActionList().Get(gMutatingEventId)->size(), 1u);
+    gMutatingEvents = nullptr;
+}
+
+TEST(EventsListenerArrayTest, GetUnknownEventReturnsEmptyArray) {
+    Events events;
+    auto actions = events.GetActionList().Get(static_cast<EventID>(12345));
+    ASSERT_NE(actions, nullptr);
+    EXPECT_TRUE(actions->empty());
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ship/resource/File.h"
+#include "ship/resource/archive/FolderArchive.h"
+#include "ship/utils/StrHash64.h"
+#include "temp_directory.h"
+
+namespace {
+std::string MakePattern(size_t size) {
+    std::string data(size, '\0');
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<char>((i * 31 + i / 251) & 0xFF);
+    }
+    return data;
+}
+
+std::string BufferToString(const std::shared_ptr<Ship::File>& file) {
+    return std::string(file->Buffer->begin(), file->Buffer->end());
+}
+} // namespace
+
+// ============================================================
+// Indexing
+// ============================================================
+
+TEST(FolderArchive, IndexesNestedDirectoriesByPathHash) {
+    TempDirectory folder("folder_archive_test_nested");
+    folder.WriteFile("root.txt", "root");
+    folder.WriteFile("a/one.txt", "one");
+    folder.WriteFile("a/b/c/deep.txt", "deep");
+    folder.WriteFile("d/two.txt", "two");
+
+    Ship::FolderArchive archive(folder.GetPath().string());
+    archive.Load();
+    ASSERT_TRUE(archive.IsInitialized());
+
+    for (const std::string path : { "root.txt", "a/one.txt", "a/b/c/deep.txt", "d/two.txt" }) {
+        EXPECT_TRUE(archive.HasFile(path)) << path;
+        EXPECT_TRUE(archive.HasFile(CRC64(path.c_str()))) << path;
+    }
+    EXPECT_FALSE(archive.HasFile("a/b"));
+
+    auto files = archive.ListFiles();
+    EXPECT_EQ(files->at(CRC64("a/b/c/deep.txt")), "a/b/c/deep.txt");
+}
+
+TEST(FolderArchive, LoadsByPathAndByHash) {
+    TempDirectory folder("folder_archive_test_hash");
+    folder.WriteFile("a/b/c/deep.txt", "deep contents");
+
+    Ship::FolderArchive archive(folder.GetPath().string());
+    archive.Load();
+
+    auto byPath = archive.LoadFile("a/b/c/deep.txt");
+    ASSERT_NE(byPath, nullptr);
+    EXPECT_TRUE(byPath->IsLoaded);
+    EXPECT_EQ(BufferToString(byPath), "deep contents");
+
+    auto byHash = archive.LoadFile(CRC64("a/b/c/deep.txt"));
+    ASSERT_NE(byHash, nullptr);
+    EXPECT_EQ(BufferToString(byHash), "deep contents");
+}
+
+// ============================================================
+// Reading
+// ============================================================
+
+TEST(FolderArchive, LoadsEmptyFile) {
+    TempDirectory folder("folder_archive_test_empty");
+    folder.WriteFile("empty.bin", "");
+
+    Ship::FolderArchive archive(folder.GetPath().string());
+    archive.Load();
+
+    auto file = archive.LoadFile("empty.bin");
+    ASSERT_NE(file, nullptr);
+    EXPECT_TRUE(file->IsLoaded);
+    EXPECT_TRUE(file->Buffer->empty());
+
+    size_t streamed = 0;
+    EXPECT_TRUE(archive.StreamFile("empty.bin", [&streamed](const uint8_t*, size_t size) {
+        streamed += size;
+        return true;
+    }));
+    EXPECT_EQ(streamed, 0u);
+}
+
+TEST(FolderArchive, LoadsAndStreamsFilesLargerThanOneChunk) {
+    TempDirectory folder("folder_archive_test_large");
+    const std::string content = MakePattern(3 * 64 * 1024 + 123);
+    folder.WriteFile("big/blob.bin", content);
+
+    Ship::FolderArchive archive(folder.GetPath().string());
+    archive.Load();
+
+    auto file = archive.LoadFile("big/blob.bin");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(BufferToString(file), content);
+
+    std::string streamed;
+    size_t chunks = 0;
+    EXPECT_TRUE(archive.StreamFile("big/blob.bin", [&](const uint8_t* data, size_t size) {
+        streamed.append(reinterpret_cast<const char*>(data), size);
+        chunks++;
+        return true;
+    }));
+    EXPECT_EQ(streamed, content);
+    EXPECT_GT(chunks, 1u);
+}
+
+TEST(FolderArchive, StreamStopsWhenConsumerRejects) {
+    TempDirectory folder("folder_archive_test_reject");
+    folder.WriteFile("blob.bin", MakePattern(3 * 64 * 1024));
+
+    Ship::FolderArchive archive(folder.GetPath().string());
+    archive.Load();
+
+    size_t chunks = 0;
+    EXPECT_FALSE(archive.StreamFile("blob.bin", [&chunks](const uint8_t*, size_t) {
+        chunks++;
+        return false;
+    }));
+    EXPECT_EQ(chunks, 1u);
+}
+
+// ============================================================
+// Missing and late files
+// ============================================================
+
+TEST(FolderArchive, MissingFileReturnsNull) {
+    TempDirectory folder("folder_archive_test_missing");
+    folder.WriteFile("present.txt", "here");
+
+    Ship::FolderArchive archive(folder.GetPath().string());
+    archive.Load();
+
+    EXPECT_EQ(archive.LoadFile("absent.txt"), nullptr);
+    EXPECT_EQ(archive.LoadFile(CRC64("absent.txt")), nullptr);
+    EXPECT_FALSE(archive.StreamFile("absent.txt", [](const uint8_t*, size_t) { return true; }));
+}
+
+TEST(FolderArchive, FileAddedAfterOpenLoadsByPath) {
+    TempDirectory folder("folder_archive_test_late");
+    folder.WriteFile("present.txt", "here");
+
+    Ship::FolderArchive archive(folder.GetPath().string());
+    archive.Load();
+    folder.WriteFile("later/added.txt", "late");
+
+    auto file = archive.LoadFile("later/added.txt");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(BufferToString(file), "late");
+}
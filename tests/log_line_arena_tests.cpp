@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <cstdarg>
+#include <string>
+#include "ship/log/LogLineArena.h"
+
+using namespace Ship;
+
+namespace {
+uint64_t AppendFormatted(LogLineArena& arena, spdlog::level::level_enum priority, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    const uint64_t seq = arena.AppendV(priority, fmt, args);
+    va_end(args);
+    return seq;
+}
+} // namespace
+
+TEST(LogLineArena, FormatsIntoStorage) {
+    LogLineArena arena(8, 256);
+    const uint64_t seq = AppendFormatted(arena, spdlog::level::warn, "value=%d name=%s", 42, "link");
+
+    ASSERT_TRUE(arena.Contains(seq));
+    EXPECT_STREQ(arena.GetText(seq), "value=42 name=link");
+    EXPECT_EQ(arena.GetTextView(seq), "value=42 name=link");
+    EXPECT_EQ(arena.GetPriority(seq), spdlog::level::warn);
+}
+
+TEST(LogLineArena, EvictsOldestWhenLineLimitReached) {
+    LogLineArena arena(4, 1024);
+    for (int i = 0; i < 10; i++) {
+        AppendFormatted(arena, spdlog::level::info, "line %d", i);
+    }
+
+    EXPECT_EQ(arena.FirstSeq(), 6u);
+    EXPECT_EQ(arena.NextSeq(), 10u);
+    for (uint64_t seq = arena.FirstSeq(); seq < arena.NextSeq(); seq++) {
+        EXPECT_EQ(arena.GetTextView(seq), "line " + std::to_string(seq));
+    }
+}
+
+TEST(LogLineArena, EvictsOldestWhenTextRunsOutAndKeepsLinesContiguous) {
+    // 10 byte lines (9 chars + terminator) in a 64 byte ring: at most 6 fit, and every wrap skips the tail.
+    LogLineArena arena(100, 64);
+    for (int i = 0; i < 50; i++) {
+        AppendFormatted(arena, spdlog::level::info, "entry-%03d", i);
+
+        for (uint64_t seq = arena.FirstSeq(); seq < arena.NextSeq(); seq++) {
+            char expected[16];
+            snprintf(expected, sizeof(expected), "entry-%03d", static_cast<int>(seq));
+            ASSERT_STREQ(arena.GetText(seq), expected);
+        }
+        ASSERT_LE(arena.NextSeq() - arena.FirstSeq(), 6u);
+    }
+    EXPECT_GE(arena.NextSeq() - arena.FirstSeq(), 5u);
+}
+
+TEST(LogLineArena, LongLinesFallBackAndTruncateToCapacity) {
+    LogLineArena arena(8, 32);
+    AppendFormatted(arena, spdlog::level::info, "short");
+    const std::string longText(100, 'x');
+    const uint64_t seq = AppendFormatted(arena, spdlog::level::err, "%s", longText.c_str());
+
+    EXPECT_EQ(arena.FirstSeq(), seq);
+    EXPECT_EQ(arena.GetTextView(seq), std::string(31, 'x'));
+    EXPECT_EQ(arena.GetPriority(seq), spdlog::level::err);
+}
+
+TEST(LogLineArena, AppendCopiesPreformattedText) {
+    LogLineArena arena(8, 64);
+    const uint64_t seq = arena.Append(spdlog::level::debug, "100% literal %s");
+    EXPECT_STREQ(arena.GetText(seq), "100% literal %s");
+}
+
+TEST(LogLineArena, ClearRestartsSequenceNumbers) {
+    LogLineArena arena(8, 64);
+    AppendFormatted(arena, spdlog::level::info, "a");
+    AppendFormatted(arena, spdlog::level::info, "b");
+    arena.Clear();
+
+    EXPECT_EQ(arena.FirstSeq(), 0u);
+    EXPECT_EQ(arena.NextSeq(), 0u);
+    EXPECT_FALSE(arena.Contains(0));
+    const uint64_t seq = AppendFormatted(arena, spdlog::level::info, "c");
+    EXPECT_EQ(seq, 0u);
+    EXPECT_STREQ(arena.GetText(seq), "c");
+}
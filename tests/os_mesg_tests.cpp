@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "libultraship/libultra/message.h"
+
+// OS_MESG_32 uses a C compound literal, which not every C++ compiler accepts.
+static OSMesg Mesg32(u32 value) {
+    OSMesg msg;
+    msg.data32 = value;
+    return msg;
+}
+
+// ============================================================
+// Non-blocking behaviour
+// ============================================================
+
+TEST(OSMesgQueue, NonBlockingSendFailsWhenFull) {
+    OSMesg buf[2];
+    OSMesgQueue mq;
+    osCreateMesgQueue(&mq, buf, 2);
+
+    EXPECT_EQ(osSendMesg(&mq, Mesg32(1), OS_MESG_NOBLOCK), 0);
+    EXPECT_EQ(osSendMesg(&mq, Mesg32(2), OS_MESG_NOBLOCK), 0);
+    EXPECT_EQ(osSendMesg(&mq, Mesg32(3), OS_MESG_NOBLOCK), -1);
+    EXPECT_EQ(mq.validCount, 2);
+}
+
+TEST(OSMesgQueue, NonBlockingRecvFailsWhenEmpty) {
+    OSMesg buf[2];
+    OSMesgQueue mq;
+    osCreateMesgQueue(&mq, buf, 2);
+
+    OSMesg msg;
+    EXPECT_EQ(osRecvMesg(&mq, &msg, OS_MESG_NOBLOCK), -1);
+}
+
+TEST(OSMesgQueue, MessagesArriveInOrderAndJamGoesFirst) {
+    OSMesg buf[4];
+    OSMesgQueue mq;
+    osCreateMesgQueue(&mq, buf, 4);
+
+    // Jamming into an empty queue is valid; only a full queue rejects it.
+    EXPECT_EQ(osJamMesg(&mq, Mesg32(10), OS_MESG_NOBLOCK), 0);
+    osSendMesg(&mq, Mesg32(11), OS_MESG_NOBLOCK);
+    osSendMesg(&mq, Mesg32(12), OS_MESG_NOBLOCK);
+    EXPECT_EQ(osJamMesg(&mq, Mesg32(9), OS_MESG_NOBLOCK), 0);
+    EXPECT_EQ(osJamMesg(&mq, Mesg32(8), OS_MESG_NOBLOCK), -1);
+
+    for (u32 expected = 9; expected <= 12; expected++) {
+        OSMesg msg;
+        ASSERT_EQ(osRecvMesg(&mq, &msg, OS_MESG_NOBLOCK), 0);
+        EXPECT_EQ(msg.data32, expected);
+    }
+}
+
+// ============================================================
+// Blocking behaviour
+// ============================================================
+
+TEST(OSMesgQueue, BlockingRecvWaitsForSender) {
+    OSMesg buf[1];
+    OSMesgQueue mq;
+    osCreateMesgQueue(&mq, buf, 1);
+
+    std::atomic<bool> received{ false };
+    OSMesg msg;
+    std::thread receiver([&]() {
+        EXPECT_EQ(osRecvMesg(&mq, &msg, OS_MESG_BLOCK), 0);
+        received = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(received);
+
+    osSendMesg(&mq, Mesg32(42), OS_MESG_NOBLOCK);
+    receiver.join();
+    EXPECT_TRUE(received);
+    EXPECT_EQ(msg.data32, 42u);
+}
+
+TEST(OSMesgQueue, BlockingSendWaitsForSpace) {
+    OSMesg buf[1];
+    OSMesgQueue mq;
+    osCreateMesgQueue(&mq, buf, 1);
+    osSendMesg(&mq, Mesg32(1), OS_MESG_NOBLOCK);
+
+    std::atomic<bool> sent{ false };
+    std::thread sender([&]() {
+        EXPECT_EQ(osSendMesg(&mq, Mesg32(2), OS_MESG_BLOCK), 0);
+        sent = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(sent);
+
+    OSMesg msg;
+    ASSERT_EQ(osRecvMesg(&mq, &msg, OS_MESG_NOBLOCK), 0);
+    EXPECT_EQ(msg.data32, 1u);
+    sender.join();
+    EXPECT_TRUE(sent);
+
+    ASSERT_EQ(osRecvMesg(&mq, &msg, OS_MESG_NOBLOCK), 0);
+    EXPECT_EQ(msg.data32, 2u);
+}
+
+TEST(OSMesgQueue, ProducerConsumerThreadsDeliverEverything) {
+    constexpr u32 kCount = 20000;
+    OSMesg buf[8];
+    OSMesgQueue mq;
+    osCreateMesgQueue(&mq, buf, 8);
+
+    std::thread producer([&]() {
+        for (u32 i = 0; i < kCount; i++) {
+            osSendMesg(&mq, Mesg32(i), OS_MESG_BLOCK);
+        }
+    });
+
+    bool inOrder = true;
+    for (u32 i = 0; i < kCount; i++) {
+        OSMesg msg;
+        osRecvMesg(&mq, &msg, OS_MESG_BLOCK);
+        inOrder = inOrder && msg.data32 == i;
+    }
+    producer.join();
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(mq.validCount, 0);
+}
@@ -0,0 +1,134 @@
+#ifdef INCLUDE_MPQ_SUPPORT
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ship/resource/File.h"
+#include "ship/resource/archive/OtrArchive.h"
+#include "ship/utils/StrHash64.h"
+#include "temp_directory.h"
+
+namespace {
+constexpr int32_t kFileCount = 16;
+
+std::string FilePath(int32_t index) {
+    return "dir" + std::to_string(index % 4) + "/file" + std::to_string(index) + ".bin";
+}
+
+std::string FileContent(int32_t index) {
+    // Sizes vary from a few bytes to several StormLib sectors.
+    std::string content(static_cast<size_t>(index) * 1537 + 7, '\0');
+    for (size_t i = 0; i < content.size(); i++) {
+        content[i] = static_cast<char>((i * 13 + index) & 0xFF);
+    }
+    return content;
+}
+
+// Scratch directory holding an MPQ archive with kFileCount files laid out by FilePath() and FileContent().
+class TempMpq : public TempDirectory {
+  public:
+    explicit TempMpq(const std::string& name) : TempDirectory("otr_archive_test_" + name) {
+        HANDLE mpq = nullptr;
+        EXPECT_TRUE(SFileCreateArchive(GetArchivePath().c_str(), MPQ_CREATE_LISTFILE | MPQ_CREATE_ARCHIVE_V2,
+                                       kFileCount + 4, &mpq));
+        for (int32_t i = 0; i < kFileCount; i++) {
+            const std::string content = FileContent(i);
+            HANDLE file = nullptr;
+            EXPECT_TRUE(SFileCreateFile(mpq, FilePath(i).c_str(), 0, static_cast<DWORD>(content.size()), 0,
+                                        MPQ_FILE_COMPRESS | MPQ_FILE_REPLACEEXISTING, &file));
+            EXPECT_TRUE(SFileWriteFile(file, content.data(), static_cast<DWORD>(content.size()), MPQ_COMPRESSION_ZLIB));
+            EXPECT_TRUE(SFileFinishFile(file));
+        }
+        SFileCloseArchive(mpq);
+    }
+
+    std::string GetArchivePath() const {
+        return (GetPath() / "archive.otr").string();
+    }
+};
+
+bool Matches(const std::shared_ptr<Ship::File>& file, int32_t index) {
+    return file != nullptr && file->IsLoaded &&
+           std::string(file->Buffer->begin(), file->Buffer->end()) == FileContent(index);
+}
+} // namespace
+
+TEST(OtrArchive, LoadsByPathAndHash) {
+    TempMpq mpq("basic");
+    Ship::OtrArchive archive(mpq.GetArchivePath());
+    archive.Load();
+    ASSERT_TRUE(archive.IsInitialized());
+
+    for (int32_t i = 0; i < kFileCount; i++) {
+        EXPECT_TRUE(Matches(archive.LoadFile(FilePath(i)), i)) << FilePath(i);
+        EXPECT_TRUE(Matches(archive.LoadFile(CRC64(FilePath(i).c_str())), i)) << FilePath(i);
+    }
+    EXPECT_EQ(archive.LoadFile("missing.bin"), nullptr);
+    EXPECT_EQ(archive.LoadFile(CRC64("missing.bin")), nullptr);
+}
+
+TEST(OtrArchive, ConcurrentLoadsReturnCorrectData) {
+    TempMpq mpq("concurrent");
+    Ship::OtrArchive archive(mpq.GetArchivePath());
+    archive.Load();
+    ASSERT_TRUE(archive.IsInitialized());
+
+    std::atomic<int32_t> mismatches{ 0 };
+    std::vector<std::thread> readers;
+    for (int32_t t = 0; t < 8; t++) {
+        readers.emplace_back([&, t]() {
+            for (int32_t round = 0; round < 10; round++) {
+                for (int32_t i = 0; i < kFileCount; i++) {
+                    const int32_t index = (i + t) % kFileCount;
+                    auto file = (round % 2 == 0) ? archive.LoadFile(FilePath(index))
+                                                 : archive.LoadFile(CRC64(FilePath(index).c_str()));
+                    if (!Matches(file, index)) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST(OtrArchive, LoadsRacingCloseEitherSucceedOrReturnNull) {
+    TempMpq mpq("close");
+    Ship::OtrArchive archive(mpq.GetArchivePath());
+    archive.Load();
+    ASSERT_TRUE(archive.IsInitialized());
+
+    std::atomic<bool> started{ false };
+    std::atomic<int32_t> corrupt{ 0 };
+    std::vector<std::thread> readers;
+    for (int32_t t = 0; t < 4; t++) {
+        readers.emplace_back([&]() {
+            for (int32_t i = 0; i < 200; i++) {
+                started = true;
+                auto file = archive.LoadFile(FilePath(i % kFileCount));
+                if (file != nullptr && !Matches(file, i % kFileCount)) {
+                    corrupt++;
+                }
+            }
+        });
+    }
+    while (!started) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(archive.Close());
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(corrupt.load(), 0);
+    EXPECT_EQ(archive.LoadFile(FilePath(0)), nullptr);
+}
+
+#endif // INCLUDE_MPQ_SUPPORT
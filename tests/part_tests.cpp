@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <thread>
+#include <vector>
 #include "ship/core/Part.h"
 #include "ship/core/PartList.h"
 
@@ -304,6 +306,108 @@ TEST(PartListTest, GetFirstReturnsFirstMatch) {
     EXPECT_EQ(found, a1);
 }
 
+// ---- Typed index tests ----
+
+class TypeASub : public TypeA {};
+
+class ReversiblePartList : public PartList<Component> {
+  public:
+    void Reverse() {
+        auto& list = GetList();
+        std::reverse(list.begin(), list.end());
+    }
+};
+
+TEST(PartListTypeIndexTest, TypeQueriedBeforeAddSeesLaterAdds) {
+    PartList<Component> list;
+    EXPECT_EQ(list.GetFirst<TypeA>(), nullptr);
+
+    auto a = std::make_shared<TypeA>();
+    list.Add(std::make_shared<TypeB>());
+    list.Add(a);
+
+    EXPECT_EQ(list.GetFirst<TypeA>(), a);
+    EXPECT_EQ(list.Get<TypeA>()->size(), 1u);
+}
+
+TEST(PartListTypeIndexTest, BaseTypeLookupIncludesDerivedParts) {
+    PartList<Component> list;
+    auto sub = std::make_shared<TypeASub>();
+    auto a = std::make_shared<TypeA>();
+    list.Add(sub);
+    list.Add(a);
+
+    auto typed = list.Get<TypeA>();
+    ASSERT_EQ(typed->size(), 2u);
+    EXPECT_EQ((*typed)[0], sub);
+    EXPECT_EQ((*typed)[1], a);
+    EXPECT_EQ(list.GetFirst<TypeASub>(), sub);
+    EXPECT_EQ(list.GetFirst<Component>(), sub);
+}
+
+TEST(PartListTypeIndexTest, RemoveDropsPartFromTypeAndIdIndexes) {
+    PartList<Component> list;
+    auto a1 = std::make_shared<TypeA>();
+    auto a2 = std::make_shared<TypeA>();
+    list.Add(a1);
+    list.Add(a2);
+    ASSERT_EQ(list.GetFirst<TypeA>(), a1);
+
+    list.Remove(a1);
+    EXPECT_EQ(list.GetFirst<TypeA>(), a2);
+    EXPECT_EQ(list.Get(a1->GetId()), nullptr);
+    EXPECT_EQ(list.Get(a2->GetId()), a2);
+
+    list.Remove<TypeA>();
+    EXPECT_FALSE(list.Has<TypeA>());
+    EXPECT_FALSE(list.Has(a2->GetId()));
+}
+
+TEST(PartListTypeIndexTest, ReorderingThroughGetListIsReflectedInTypedLookups) {
+    ReversiblePartList list;
+    auto a1 = std::make_shared<TypeA>();
+    auto a2 = std::make_shared<TypeA>();
+    list.Add(a1);
+    list.Add(a2);
+    ASSERT_EQ(list.GetFirst<TypeA>(), a1);
+
+    list.Reverse();
+    EXPECT_EQ(list.GetFirst<TypeA>(), a2);
+    EXPECT_EQ(list.Get(a1->GetId()), a1);
+}
+
+TEST(PartListTypeIndexTest, ConcurrentTypedLookupsAfterModification) {
+    ReversiblePartList list;
+    auto a = std::make_shared<TypeA>();
+    auto b = std::make_shared<TypeB>();
+    auto sub = std::make_shared<TypeASub>();
+    list.Add(a);
+    list.Add(b);
+    list.Add(sub);
+    ASSERT_EQ(list.GetFirst<TypeA>(), a);
+
+    // Leaves the type index dirty, so the first reader rebuilds it while the others register new types.
+    list.Reverse();
+
+    std::atomic<int32_t> mismatches{ 0 };
+    std::vector<std::thread> readers;
+    for (int32_t i = 0; i < 8; i++) {
+        readers.emplace_back([&]() {
+            for (int32_t j = 0; j < 200; j++) {
+                if (list.GetFirst<TypeA>() != sub || list.GetFirst<TypeB>() != b || !list.Has<TypeASub>() ||
+                    list.Get<Component>()->size() != 3) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
 // ---- PartList storage policy tests ----
 
 TEST(PartListStoragePolicyTest, StrongStorageOwnsPartUntilRemoved) {
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstring>
 #include <memory>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -17,6 +19,12 @@
 #include "ship/utils/binarytools/BinaryReader.h"
 #include "ship/utils/binarytools/MemoryStream.h"
 #include "ship/utils/binarytools/endianness.h"
+#include "fast/lus_gbi.h"
+#include "fast/resource/factory/DisplayListFactory.h"
+#include "fast/resource/factory/VertexFactory.h"
+#include "fast/resource/type/DisplayList.h"
+#include "fast/resource/type/Vertex.h"
+#include "libultraship/libultra/gbi.h"
 
 // ============================================================
 // Helpers
@@ -348,6 +356,221 @@ TEST(ShaderFactory, EmptyShaderSourceProducesResourceWithNullByte) {
     EXPECT_EQ(shader->Data[0], '\0');
 }
 
+// ============================================================
+// ResourceFactoryBinaryVertexV0
+// ============================================================
+
+// Appends @p value to @p body, byte-swapped when @p swap is set.
+template <typename T> static void AppendValue(std::vector<char>& body, T value, bool swap) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if (swap) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    body.insert(body.end(), bytes, bytes + sizeof(T));
+}
+
+// Builds a uint32 vertex count followed by @p count vertex records, in the opposite byte order when @p swap is set.
+static std::vector<char> MakeVertexBody(uint32_t count, bool swap) {
+    std::vector<char> body;
+    AppendValue<uint32_t>(body, count, swap);
+    for (uint32_t i = 0; i < count; i++) {
+        AppendValue<int16_t>(body, static_cast<int16_t>(i), swap);
+        AppendValue<int16_t>(body, -static_cast<int16_t>(i), swap);
+        AppendValue<int16_t>(body, 100, swap);
+        AppendValue<uint16_t>(body, 0, swap);
+        AppendValue<int16_t>(body, static_cast<int16_t>(i * 32), swap);
+        AppendValue<int16_t>(body, 64, swap);
+        body.push_back(static_cast<char>(i));
+        body.push_back(0);
+        body.push_back(0);
+        body.push_back(static_cast<char>(0xFF));
+    }
+    return body;
+}
+
+static void ExpectVertices(const Fast::Vertex& vertex, uint32_t count) {
+    ASSERT_EQ(vertex.VertexList.size(), count);
+    for (uint32_t i = 0; i < count; i++) {
+        const Vtx& vtx = vertex.VertexList[i];
+        EXPECT_EQ(vtx.v.ob[0], static_cast<int16_t>(i));
+        EXPECT_EQ(vtx.v.ob[1], -static_cast<int16_t>(i));
+        EXPECT_EQ(vtx.v.ob[2], 100);
+        EXPECT_EQ(vtx.v.tc[0], static_cast<int16_t>(i * 32));
+        EXPECT_EQ(vtx.v.tc[1], 64);
+        EXPECT_EQ(vtx.v.cn[0], static_cast<uint8_t>(i));
+        EXPECT_EQ(vtx.v.cn[3], 0xFF);
+    }
+}
+
+TEST(VertexFactory, NativeOrderVerticesAreRead) {
+    Fast::ResourceFactoryBinaryVertexV0 factory;
+    auto initData = MakeBinaryInitData();
+
+    auto file = MakeBinaryFile(MakeVertexBody(3, false), initData);
+    auto vertex = std::dynamic_pointer_cast<Fast::Vertex>(factory.ReadResource(file, initData));
+    ASSERT_NE(vertex, nullptr);
+
+    ExpectVertices(*vertex, 3);
+    EXPECT_EQ(vertex->GetPointer(), vertex->VertexList.data());
+    EXPECT_EQ(vertex->GetPointerSize(), 3 * sizeof(Vtx));
+}
+
+TEST(VertexFactory, SwappedOrderVerticesAreRead) {
+    Fast::ResourceFactoryBinaryVertexV0 factory;
+    auto initData = MakeBinaryInitData();
+    initData->ByteOrder =
+        Ship::Endianness::Native == Ship::Endianness::Little ? Ship::Endianness::Big : Ship::Endianness::Little;
+
+    auto file = MakeBinaryFile(MakeVertexBody(3, true), initData);
+    auto vertex = std::dynamic_pointer_cast<Fast::Vertex>(factory.ReadResource(file, initData));
+    ASSERT_NE(vertex, nullptr);
+
+    ExpectVertices(*vertex, 3);
+}
+
+TEST(VertexFactory, ReaderStopsAfterVertexRecords) {
+    Fast::ResourceFactoryBinaryVertexV0 factory;
+    auto initData = MakeBinaryInitData();
+
+    auto body = MakeVertexBody(2, false);
+    const size_t blockSize = body.size();
+    body.push_back(0x7F);
+    auto file = MakeBinaryFile(body, initData);
+    auto vertex = std::dynamic_pointer_cast<Fast::Vertex>(factory.ReadResource(file, initData));
+    ASSERT_NE(vertex, nullptr);
+
+    ExpectVertices(*vertex, 2);
+    EXPECT_EQ(std::get<std::shared_ptr<Ship::BinaryReader>>(file->Reader)->GetBaseAddress(), blockSize);
+}
+
+// ============================================================
+// ResourceFactoryBinaryDisplayListV0
+// ============================================================
+
+using DisplayListWords = std::vector<std::pair<uint32_t, uint32_t>>;
+
+// Builds an F3DEX2 display list body: the ucode byte padded to 8 bytes, then two words per command.
+static std::vector<char> MakeDisplayListBody(const DisplayListWords& commands, bool swap) {
+    std::vector<char> body(8, 0);
+    body[0] = static_cast<char>(ucode_f3dex2);
+    for (const auto& [w0, w1] : commands) {
+        AppendValue<uint32_t>(body, w0, swap);
+        AppendValue<uint32_t>(body, w1, swap);
+    }
+    return body;
+}
+
+// The word-by-word loop the factory used before it read the command block in bulk, kept as the reference.
+static DisplayListWords ReadDisplayListWordByWord(Ship::BinaryReader& reader) {
+    DisplayListWords words;
+    reader.ReadInt8();
+    while (reader.GetBaseAddress() % 8 != 0) {
+        reader.ReadInt8();
+    }
+    while (true) {
+        uint32_t w0 = reader.ReadUInt32();
+        uint32_t w1 = reader.ReadUInt32();
+        const int8_t opcode = (int8_t)(w0 >> 24);
+        if (opcode == G_SETTIMG_OTR_HASH || opcode == G_DL_OTR_HASH || opcode == G_VTX_OTR_HASH ||
+            opcode == G_BRANCH_Z_OTR || opcode == G_MARKER || opcode == G_MTX_OTR || opcode == G_MOVEMEM_OTR) {
+            words.emplace_back(w0, w1);
+            w0 = reader.ReadUInt32();
+            w1 = reader.ReadUInt32();
+        }
+        words.emplace_back(w0, w1);
+        if (opcode == Fast::F3DEX2_G_ENDDL) {
+            break;
+        }
+    }
+    return words;
+}
+
+static DisplayListWords InstructionWords(const Fast::DisplayList& displayList) {
+    DisplayListWords words;
+    for (const Gfx& command : displayList.Instructions) {
+        words.emplace_back(static_cast<uint32_t>(command.words.w0), static_cast<uint32_t>(command.words.w1));
+    }
+    return words;
+}
+
+static uint32_t Opcode(uint32_t opcode) {
+    return opcode << 24;
+}
+
+// Reads @p body with the factory and with the reference loop, and expects identical commands and end positions.
+static void ExpectDisplayListMatchesWordByWord(const DisplayListWords& commands, bool swap) {
+    Fast::ResourceFactoryBinaryDisplayListV0 factory;
+    auto initData = MakeBinaryInitData();
+    if (swap) {
+        initData->ByteOrder =
+            Ship::Endianness::Native == Ship::Endianness::Little ? Ship::Endianness::Big : Ship::Endianness::Little;
+    }
+    const auto body = MakeDisplayListBody(commands, swap);
+
+    auto referenceFile = MakeBinaryFile(body, initData);
+    auto referenceReader = std::get<std::shared_ptr<Ship::BinaryReader>>(referenceFile->Reader);
+    const auto expected = ReadDisplayListWordByWord(*referenceReader);
+
+    auto file = MakeBinaryFile(body, initData);
+    auto displayList = std::dynamic_pointer_cast<Fast::DisplayList>(factory.ReadResource(file, initData));
+    ASSERT_NE(displayList, nullptr);
+    EXPECT_EQ(displayList->UCode, ucode_f3dex2);
+    EXPECT_EQ(InstructionWords(*displayList), expected);
+    EXPECT_EQ(std::get<std::shared_ptr<Ship::BinaryReader>>(file->Reader)->GetBaseAddress(),
+              referenceReader->GetBaseAddress());
+}
+
+// Pipe sync, a display list call and a marker (each followed by its 64-bit payload), then the end opcode and a
+// trailing command that must not be read.
+static const DisplayListWords kDisplayListCommands = {
+    { Opcode(G_RDPPIPESYNC), 0 },
+    { Opcode(G_DL_OTR_HASH), 0 },
+    { 0x12345678, 0x9ABCDEF0 },
+    { Opcode(G_MARKER), 0 },
+    { 0xCAFEF00D, 0x0BADF00D },
+    { Opcode(G_RDPPIPESYNC), 0 },
+    { Opcode(0xDF), 0 },
+    { Opcode(G_RDPPIPESYNC), 0 },
+};
+
+TEST(DisplayListFactory, NativeOrderMatchesWordByWordRead) {
+    ExpectDisplayListMatchesWordByWord(kDisplayListCommands, false);
+}
+
+TEST(DisplayListFactory, SwappedOrderMatchesWordByWordRead) {
+    ExpectDisplayListMatchesWordByWord(kDisplayListCommands, true);
+}
+
+TEST(DisplayListFactory, ExpandedPayloadIsNotReadAsAnOpcode) {
+    // The payload words of an expanded command start with the end opcode; only the real end command stops the list.
+    ExpectDisplayListMatchesWordByWord({ { Opcode(G_DL_OTR_HASH), 0 },
+                                         { Opcode(0xDF), 0 },
+                                         { Opcode(G_MARKER), 0 },
+                                         { Opcode(0xDF), 0x11111111 },
+                                         { Opcode(0xDF), 0 } },
+                                       false);
+}
+
+TEST(DisplayListFactory, TruncatedListStopsAtEndOfBuffer) {
+    Fast::ResourceFactoryBinaryDisplayListV0 factory;
+    auto initData = MakeBinaryInitData();
+
+    // No end opcode, and an expanded command whose payload is cut off after one word.
+    const DisplayListWords expected = { { Opcode(G_RDPPIPESYNC), 0 },
+                                        { Opcode(G_RDPPIPESYNC), 1 },
+                                        { Opcode(G_MARKER), 2 } };
+    auto body = MakeDisplayListBody(expected, false);
+    AppendValue<uint32_t>(body, 0xCAFEF00D, false);
+    auto file = MakeBinaryFile(body, initData);
+    auto displayList = std::dynamic_pointer_cast<Fast::DisplayList>(factory.ReadResource(file, initData));
+    ASSERT_NE(displayList, nullptr);
+
+    EXPECT_EQ(InstructionWords(*displayList), expected);
+    // The reader ends after the last whole command; the dangling word is left unread.
+    EXPECT_EQ(std::get<std::shared_ptr<Ship::BinaryReader>>(file->Reader)->GetBaseAddress(), 8u + 3 * 8);
+}
+
 // ============================================================
 // ResourceLoader
 // ============================================================
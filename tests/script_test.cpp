@@ -4,10 +4,15 @@
 #include <string>
 #include <vector>
 #include <filesystem>
+#include <memory>
 
 #include "ship/resource/File.h"
+#include "ship/resource/ResourceManager.h"
 #include "ship/resource/archive/Archive.h"
+#include "ship/resource/archive/ArchiveManager.h"
 #include "ship/scripting/ScriptLoader.h"
+#include "ship/thread/ThreadPool.h"
+#include "temp_directory.h"
 
 namespace fs = std::filesystem;
 
@@ -18,7 +23,9 @@ namespace fs = std::filesystem;
 namespace Ship {
 class RamArchive final : virtual public Archive {
   public:
-    RamArchive() : Archive("ram://") {
+    RamArchive(const std::string& path = "ram://", const std::string& name = "Test Script",
+               const std::string& source = "")
+        : Archive(path), mName(name), mSource(source) {
     }
 
     bool Open() override {
@@ -39,13 +46,11 @@ class RamArchive final : virtual public Archive {
         std::string content;
 
         if (filePath == "manifest.json") {
-            content = R"({
-                "name": "Test Script",
-                "code_version": 1,
-                "main": "build.gen"
-            })";
+            content = R"({"name": ")" + mName + R"(", "code_version": 1, "main": "build.gen"})";
         } else if (filePath == "build.gen") {
             content = "test.c";
+        } else if (filePath == "test.c" && !mSource.empty()) {
+            content = mSource;
         } else if (filePath == "test.c") {
             content = R"(
                 #define HM_API __attribute__((visibility("default")))
@@ -77,6 +82,10 @@ class RamArchive final : virtual public Archive {
         file->IsLoaded = true;
         return file;
     }
+
+  private:
+    std::string mName;
+    std::string mSource;
 };
 
 std::string FindLibTCC1Folder() {
@@ -153,4 +162,80 @@ TEST(ScriptLoader, CompileDefines) {
     auto fib = reinterpret_cast<int (*)(int)>(system.GetFunction("Test Script", "fib"));
     ASSERT_NE(fib, nullptr);
     EXPECT_EQ(fib(10), 20);
-}
\ No newline at end of file
+}
+
+// ============================================================
+// Compiled module cache
+// ============================================================
+
+namespace {
+int CallFib(const std::string& cacheDirectory, const std::unordered_map<std::string, std::string>& defines,
+            const std::shared_ptr<Ship::Archive>& archive) {
+    Ship::ScriptLoader system(defines, 1, "-g -Wl", {}, { Ship::FindLibTCC1Folder() }, {});
+    system.SetCacheDirectory(cacheDirectory);
+    system.Compile(archive);
+    system.LoadAll();
+    auto fib = reinterpret_cast<int (*)(int)>(system.GetFunction(archive->GetManifest().Name, "fib"));
+    return fib != nullptr ? fib(10) : -1;
+}
+} // namespace
+
+TEST(ScriptLoaderCache, ReusesModuleWithMatchingKey) {
+    ASSERT_NE(Ship::FindLibTCC1Folder(), "");
+    TempDirectory cache("script_test_cache_hit");
+    auto archive = std::make_shared<Ship::RamArchive>();
+    archive->Load();
+
+    ASSERT_EQ(CallFib(cache.GetPath().string(), {}, archive), 55);
+    const auto plainEntries = cache.ListFiles();
+    ASSERT_EQ(plainEntries.size(), 1u);
+
+    ASSERT_EQ(CallFib(cache.GetPath().string(), { { "__FIBx2__", "1" } }, archive), 20);
+    auto doubledEntries = cache.ListFiles();
+    ASSERT_EQ(doubledEntries.size(), 2u);
+    const fs::path doubled = doubledEntries[0] == plainEntries[0] ? doubledEntries[1] : doubledEntries[0];
+
+    // Swap the doubling module in under the plain build's key: only a cache hit can then return 20.
+    fs::copy_file(doubled, plainEntries[0], fs::copy_options::overwrite_existing);
+    EXPECT_EQ(CallFib(cache.GetPath().string(), {}, archive), 20);
+}
+
+TEST(ScriptLoaderCache, SourceChangeInvalidatesEntry) {
+    ASSERT_NE(Ship::FindLibTCC1Folder(), "");
+    TempDirectory cache("script_test_cache_source");
+    auto original = std::make_shared<Ship::RamArchive>();
+    original->Load();
+    auto edited = std::make_shared<Ship::RamArchive>(
+        "ram://edited", "Test Script",
+        R"(__attribute__((visibility("default"))) int fib(int n) { return n + 1; })");
+    edited->Load();
+
+    EXPECT_EQ(CallFib(cache.GetPath().string(), {}, original), 55);
+    EXPECT_EQ(CallFib(cache.GetPath().string(), {}, edited), 11);
+    EXPECT_EQ(cache.ListFiles().size(), 2u);
+}
+
+TEST(ScriptLoaderCache, CompileAllRethrowsBuildErrorWithoutBuildingDeferredArchives) {
+    ASSERT_NE(Ship::FindLibTCC1Folder(), "");
+    TempDirectory cache("script_test_cache_error");
+    TempDirectory mount("script_test_cache_error_mount");
+    mount.WriteFile("manifest.json", R"({"name":"Mount","code_version":1})");
+
+    auto resourceManager = std::make_shared<Ship::ResourceManager>(std::make_shared<Ship::ThreadPool>(1));
+    resourceManager->Init({ { "archivePaths", std::vector<std::string>{ mount.GetPath().string() } },
+                            { "validHashes", std::vector<uint32_t>{} } });
+
+    auto broken = std::make_shared<Ship::RamArchive>("ram://broken", "Broken Script", "this is not C");
+    broken->Load();
+    auto valid = std::make_shared<Ship::RamArchive>("ram://valid", "Valid Script");
+    valid->Load();
+    resourceManager->GetArchiveManager()->AddArchive(broken);
+    resourceManager->GetArchiveManager()->AddArchive(valid);
+
+    // Without a ThreadPool every build is deferred, so nothing after the failure should be compiled.
+    Ship::ScriptLoader system({}, 1, "-g -Wl", {}, { Ship::FindLibTCC1Folder() }, {}, resourceManager);
+    system.SetCacheDirectory(cache.GetPath().string());
+    EXPECT_THROW(system.CompileAll(), std::runtime_error);
+    EXPECT_TRUE(cache.ListFiles().empty());
+    EXPECT_EQ(system.GetFunction("Valid Script", "fib"), nullptr);
+}
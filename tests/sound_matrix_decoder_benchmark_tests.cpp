@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "ship/audio/SoundMatrixDecoder.h"
+
+// ============================================================
+// SoundMatrixDecoder throughput benchmarks
+//
+// Decodes the same program material with the double reference path and the
+// float path, and records the sample pairs decoded per second for each as
+// test properties.
+// ============================================================
+
+// Deterministic mix of tones and noise that exercises every crossover band.
+static std::vector<uint8_t> MakeProgramMaterial(int pairs, int32_t sampleRate) {
+    std::vector<uint8_t> buf(pairs * 2 * sizeof(int16_t));
+    uint32_t seed = 0x1234567u;
+    for (int i = 0; i < pairs; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        const double t = static_cast<double>(i) / sampleRate;
+        const double noise = (static_cast<double>(seed >> 8) / (1 << 24)) * 2.0 - 1.0;
+        const double left = 9000.0 * std::sin(2.0 * M_PI * 55.0 * t) + 6000.0 * std::sin(2.0 * M_PI * 440.0 * t) +
+                            3000.0 * noise;
+        const double right = 9000.0 * std::sin(2.0 * M_PI * 80.0 * t + 1.0) +
+                             6000.0 * std::sin(2.0 * M_PI * 3000.0 * t) - 3000.0 * noise;
+        const int16_t pair[2] = { static_cast<int16_t>(left), static_cast<int16_t>(right) };
+        std::memcpy(&buf[i * 4], pair, sizeof(pair));
+    }
+    return buf;
+}
+
+static double MeasureSamplePairsPerSecond(Ship::SoundMatrixDecoder::Precision precision) {
+    constexpr int32_t kSampleRate = 44100;
+    constexpr int kBufferPairs = 1024;
+    constexpr int kIterations = 400;
+
+    Ship::SoundMatrixDecoder dec(kSampleRate, precision);
+    auto input = MakeProgramMaterial(kBufferPairs, kSampleRate);
+    int64_t checksum = 0;
+    size_t decodedBytes = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; i++) {
+        auto [ptr, len] = dec.Process(input.data(), input.size());
+        checksum += reinterpret_cast<const int16_t*>(ptr)[len / sizeof(int16_t) - 1];
+        decodedBytes += len;
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Six output channels per input pair; the checksum keeps the decode from being optimized away.
+    EXPECT_EQ(decodedBytes, static_cast<size_t>(kIterations) * kBufferPairs * 6 * sizeof(int16_t));
+    EXPECT_NE(checksum, INT64_MIN);
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(kBufferPairs) * kIterations / seconds;
+}
+
+TEST(SoundMatrixDecoderBenchmark, FloatVersusDoubleThroughput) {
+    const double reference = MeasureSamplePairsPerSecond(Ship::SoundMatrixDecoder::Precision::Double);
+    const double simd = MeasureSamplePairsPerSecond(Ship::SoundMatrixDecoder::Precision::Float);
+    ::testing::Test::RecordProperty("double_pairs_per_second", std::to_string(reference));
+    ::testing::Test::RecordProperty("float_pairs_per_second", std::to_string(simd));
+    ::testing::Test::RecordProperty("float_speedup", std::to_string(simd / reference));
+
+    EXPECT_GT(reference, 0.0);
+    EXPECT_GT(simd, 0.0);
+}
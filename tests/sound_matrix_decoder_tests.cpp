@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <vector>
 #include <cstring>
 #include <tuple>
@@ -162,3 +165,66 @@ TEST(SoundMatrixDecoder, SameInputProducesSameOutput) {
     ASSERT_EQ(len1, len2);
     EXPECT_EQ(out1, out2);
 }
+
+// ============================================================
+// Float path vs. double reference
+// ============================================================
+
+// Deterministic mix of tones and noise that exercises every crossover band.
+static std::vector<uint8_t> MakeProgramMaterial(int pairs, int32_t sampleRate) {
+    std::vector<std::pair<int16_t, int16_t>> samples(pairs);
+    uint32_t seed = 0x1234567u;
+    for (int i = 0; i < pairs; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        const double t = static_cast<double>(i) / sampleRate;
+        const double noise = (static_cast<double>(seed >> 8) / (1 << 24)) * 2.0 - 1.0;
+        const double left = 9000.0 * std::sin(2.0 * M_PI * 55.0 * t) + 6000.0 * std::sin(2.0 * M_PI * 440.0 * t) +
+                            3000.0 * noise;
+        const double right = 9000.0 * std::sin(2.0 * M_PI * 80.0 * t + 1.0) +
+                             6000.0 * std::sin(2.0 * M_PI * 3000.0 * t) - 3000.0 * noise;
+        samples[i] = { static_cast<int16_t>(left), static_cast<int16_t>(right) };
+    }
+    return MakeStereoBuffer(samples);
+}
+
+TEST(SoundMatrixDecoder, DefaultPrecisionIsFloat) {
+    Ship::SoundMatrixDecoder dec(44100);
+    EXPECT_EQ(dec.GetPrecision(), Ship::SoundMatrixDecoder::Precision::Float);
+}
+
+TEST(SoundMatrixDecoder, FloatPathMatchesDoubleReference) {
+    // Max error bound in int16 LSBs for every output channel. The reference runs the crossovers as direct-form
+    // fourth-order filters in double; the float path cascades biquads, so the low-cutoff sections at 48 kHz drift
+    // by a few LSBs (about -72 dBFS), which stays bounded over long runs.
+    constexpr int kMaxError = 8;
+
+    for (int32_t sampleRate : { 32000, 44100, 48000 }) {
+        Ship::SoundMatrixDecoder reference(sampleRate, Ship::SoundMatrixDecoder::Precision::Double);
+        Ship::SoundMatrixDecoder simd(sampleRate, Ship::SoundMatrixDecoder::Precision::Float);
+
+        // Two seconds in uneven chunks so block boundaries land mid-buffer
+        auto input = MakeProgramMaterial(sampleRate * 2, sampleRate);
+        int maxError[6] = {};
+        size_t offset = 0;
+        size_t chunk = 1000 * 2 * sizeof(int16_t);
+        while (offset < input.size()) {
+            const size_t len = std::min(chunk, input.size() - offset);
+            auto [refPtr, refLen] = reference.Process(input.data() + offset, len);
+            std::vector<int16_t> expected(reinterpret_cast<const int16_t*>(refPtr),
+                                          reinterpret_cast<const int16_t*>(refPtr) + refLen / sizeof(int16_t));
+            auto [outPtr, outLen] = simd.Process(input.data() + offset, len);
+            ASSERT_EQ(outLen, refLen);
+
+            const int16_t* actual = reinterpret_cast<const int16_t*>(outPtr);
+            for (size_t i = 0; i < expected.size(); i++) {
+                maxError[i % 6] = std::max(maxError[i % 6], std::abs(actual[i] - expected[i]));
+            }
+            offset += len;
+            chunk = chunk == 1000 * 2 * sizeof(int16_t) ? 333 * 2 * sizeof(int16_t) : 1000 * 2 * sizeof(int16_t);
+        }
+
+        for (int channel = 0; channel < 6; channel++) {
+            EXPECT_LE(maxError[channel], kMaxError) << "channel " << channel << " at " << sampleRate << " Hz";
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+/**
+ * @brief Scratch directory for tests that need real files on disk.
+ *
+ * The directory is created empty under the system temp directory as "lus_<name>", replacing anything left
+ * there by an earlier run, and is removed with its contents on destruction. Tests that may run at the same
+ * time must use different names.
+ */
+class TempDirectory {
+  public:
+    explicit TempDirectory(const std::string& name)
+        : mPath(std::filesystem::temp_directory_path() / ("lus_" + name)) {
+        std::error_code ec;
+        std::filesystem::remove_all(mPath, ec);
+        std::filesystem::create_directories(mPath);
+    }
+
+    ~TempDirectory() {
+        std::error_code ec;
+        std::filesystem::remove_all(mPath, ec);
+    }
+
+    TempDirectory(const TempDirectory&) = delete;
+    TempDirectory& operator=(const TempDirectory&) = delete;
+
+    /** @brief Returns the absolute path of the directory. */
+    const std::filesystem::path& GetPath() const {
+        return mPath;
+    }
+
+    /** @brief Writes @p content to @p relativePath inside the directory, creating parent directories as needed. */
+    void WriteFile(const std::string& relativePath, const std::string& content) const {
+        const std::filesystem::path filePath = mPath / relativePath;
+        std::filesystem::create_directories(filePath.parent_path());
+        std::ofstream out(filePath, std::ios::binary);
+        out << content;
+    }
+
+    /** @brief Returns the entries directly inside the directory. */
+    std::vector<std::filesystem::path> ListFiles() const {
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::directory_iterator(mPath)) {
+            files.push_back(entry.path());
+        }
+        return files;
+    }
+
+  private:
+    std::filesystem::path mPath;
+};
@@ -4,6 +4,13 @@
 #include "ship/core/TickableList.h"
 #include "ship/core/Action.h"
 #include "ship/actions/EventAction.h"
+#include "ship/thread/ThreadPool.h"
+
+#include <algorithm>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 
 using namespace Ship;
 
@@ -373,3 +380,180 @@ TEST_F(TickableComponentTest, ForceStartOnComponentTickableDoesNotCrash) {
     EXPECT_NO_THROW(tc->Start(true));
 }
 
+
+// ============================================================
+// Context::Tick dependency scheduling tests
+// ============================================================
+
+namespace {
+constexpr EventID kScheduleEvent = 7;
+
+// Records the order and thread of every tick into a log shared between components.
+struct TickLog {
+    std::mutex Mutex;
+    std::vector<std::string> Order;
+    std::vector<std::thread::id> Threads;
+};
+
+class RecordingTickable : public TickableComponent {
+  public:
+    RecordingTickable(std::shared_ptr<Context> ctx, const std::string& name, TickLog& log)
+        : TickableComponent(name, ctx, TickGroup::TickGroupDefault, TickPriority::TickPriorityDefault,
+                            std::vector<EventID>{ kScheduleEvent }),
+          mLog(log) {
+    }
+
+    bool ActionRan(EventID eventId) override {
+        std::lock_guard<std::mutex> lock(mLog.Mutex);
+        mLog.Order.push_back(GetName());
+        mLog.Threads.push_back(std::this_thread::get_id());
+        return true;
+    }
+
+  private:
+    TickLog& mLog;
+};
+
+class ThrowingTickable : public TickableComponent {
+  public:
+    ThrowingTickable(std::shared_ptr<Context> ctx, const std::string& name)
+        : TickableComponent(name, ctx, TickGroup::TickGroupDefault, TickPriority::TickPriorityDefault,
+                            std::vector<EventID>{ kScheduleEvent }) {
+    }
+
+    bool ActionRan(EventID eventId) override {
+        throw std::runtime_error(GetName() + " failed");
+    }
+};
+
+size_t IndexOf(const std::vector<std::string>& order, const std::string& name) {
+    return std::find(order.begin(), order.end(), name) - order.begin();
+}
+} // namespace
+
+TEST_F(TickableComponentTest, ContextTickRunsUndeclaredComponentsInListOrderOnCallingThread) {
+    mContext->GetChildren().Add(std::make_shared<ThreadPool>(2));
+    TickLog log;
+    std::vector<std::shared_ptr<RecordingTickable>> tickables;
+    for (const char* name : { "a", "b", "c" }) {
+        tickables.push_back(std::make_shared<RecordingTickable>(mContext, name, log));
+        mContext->GetChildren().Add(tickables.back());
+        ASSERT_TRUE(tickables.back()->RegisterWithContext());
+    }
+
+    mContext->Tick(kScheduleEvent);
+
+    EXPECT_EQ(log.Order, (std::vector<std::string>{ "a", "b", "c" }));
+    for (const auto& thread : log.Threads) {
+        EXPECT_EQ(thread, std::this_thread::get_id());
+    }
+}
+
+TEST_F(TickableComponentTest, ContextTickOrdersWriterBeforeReaderAcrossThreads) {
+    mContext->GetChildren().Add(std::make_shared<ThreadPool>(4));
+    TickLog log;
+
+    auto writer = std::make_shared<RecordingTickable>(mContext, "writer", log);
+    writer->SetTickDependencies({}, { "Transforms" }).SetTickAffinity(TickAffinity::AnyThread);
+    auto reader = std::make_shared<RecordingTickable>(mContext, "reader", log);
+    reader->SetTickDependencies({ "Transforms" }, { "Audio" }).SetTickAffinity(TickAffinity::AnyThread);
+    auto independent = std::make_shared<RecordingTickable>(mContext, "independent", log);
+    independent->SetTickDependencies({ "Input" }, { "Particles" }).SetTickAffinity(TickAffinity::AnyThread);
+    auto main = std::make_shared<RecordingTickable>(mContext, "main", log);
+    main->SetTickDependencies({ "Audio" }, {});
+
+    for (const auto& tc : { writer, reader, independent, main }) {
+        mContext->GetChildren().Add(tc);
+        ASSERT_TRUE(tc->RegisterWithContext());
+    }
+
+    for (int frame = 0; frame < 200; frame++) {
+        log.Order.clear();
+        log.Threads.clear();
+        mContext->Tick(kScheduleEvent);
+
+        ASSERT_EQ(log.Order.size(), 4u);
+        const size_t mainIndex = IndexOf(log.Order, "main");
+        EXPECT_LT(IndexOf(log.Order, "writer"), IndexOf(log.Order, "reader"));
+        EXPECT_LT(IndexOf(log.Order, "reader"), mainIndex);
+        EXPECT_EQ(log.Threads[mainIndex], std::this_thread::get_id());
+    }
+}
+
+TEST_F(TickableComponentTest, ContextTickPicksUpDependencyChangesAfterRegistration) {
+    mContext->GetChildren().Add(std::make_shared<ThreadPool>(2));
+    TickLog log;
+
+    auto first = std::make_shared<RecordingTickable>(mContext, "first", log);
+    auto second = std::make_shared<RecordingTickable>(mContext, "second", log);
+    for (const auto& tc : { first, second }) {
+        mContext->GetChildren().Add(tc);
+        ASSERT_TRUE(tc->RegisterWithContext());
+    }
+    mContext->Tick(kScheduleEvent);
+    ASSERT_EQ(log.Order, (std::vector<std::string>{ "first", "second" }));
+
+    // Declaring a conflict after the schedule was built must keep the pair ordered.
+    first->SetTickDependencies({}, { "State" }).SetTickAffinity(TickAffinity::AnyThread);
+    second->SetTickDependencies({ "State" }, {}).SetTickAffinity(TickAffinity::AnyThread);
+    for (int frame = 0; frame < 50; frame++) {
+        log.Order.clear();
+        mContext->Tick(kScheduleEvent);
+        EXPECT_EQ(log.Order, (std::vector<std::string>{ "first", "second" }));
+    }
+}
+
+TEST_F(TickableComponentTest, ContextTickFinishesWhileThreadPoolIsBusy) {
+    auto threadPool = std::make_shared<ThreadPool>(1);
+    mContext->GetChildren().Add(threadPool);
+    TickLog log;
+
+    auto first = std::make_shared<RecordingTickable>(mContext, "first", log);
+    first->SetTickDependencies({ "A" }, { "B" }).SetTickAffinity(TickAffinity::AnyThread);
+    auto second = std::make_shared<RecordingTickable>(mContext, "second", log);
+    second->SetTickDependencies({ "C" }, { "D" }).SetTickAffinity(TickAffinity::AnyThread);
+    for (const auto& tc : { first, second }) {
+        mContext->GetChildren().Add(tc);
+        ASSERT_TRUE(tc->RegisterWithContext());
+    }
+
+    // Occupy the only worker for the whole tick; the calling thread has to run both components itself.
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto blocker = threadPool->Get()->submit_task([released]() { released.wait(); });
+
+    mContext->Tick(kScheduleEvent);
+    EXPECT_EQ(log.Order.size(), 2u);
+    for (const auto& thread : log.Threads) {
+        EXPECT_EQ(thread, std::this_thread::get_id());
+    }
+
+    release.set_value();
+    blocker.wait();
+}
+
+TEST_F(TickableComponentTest, ContextTickRethrowsExceptionFromAnyThreadComponent) {
+    mContext->GetChildren().Add(std::make_shared<ThreadPool>(4));
+    TickLog log;
+
+    auto thrower = std::make_shared<ThrowingTickable>(mContext, "thrower");
+    thrower->SetTickDependencies({}, { "State" }).SetTickAffinity(TickAffinity::AnyThread);
+    auto dependent = std::make_shared<RecordingTickable>(mContext, "dependent", log);
+    dependent->SetTickDependencies({ "State" }, {}).SetTickAffinity(TickAffinity::AnyThread);
+    auto independent = std::make_shared<RecordingTickable>(mContext, "independent", log);
+    independent->SetTickDependencies({ "Input" }, { "Particles" }).SetTickAffinity(TickAffinity::AnyThread);
+    mContext->GetChildren().Add(thrower);
+    ASSERT_TRUE(thrower->RegisterWithContext());
+    for (const auto& tc : { dependent, independent }) {
+        mContext->GetChildren().Add(tc);
+        ASSERT_TRUE(tc->RegisterWithContext());
+    }
+
+    for (int frame = 0; frame < 50; frame++) {
+        log.Order.clear();
+        EXPECT_THROW(mContext->Tick(kScheduleEvent), std::runtime_error);
+        // Whatever depended on the failed component never started.
+        std::lock_guard<std::mutex> lock(log.Mutex);
+        EXPECT_EQ(IndexOf(log.Order, "dependent"), log.Order.size());
+    }
+}
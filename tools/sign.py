@@ -10,7 +10,8 @@ import zipfile
 from cryptography.hazmat.primitives import serialization
 from cryptography.hazmat.primitives.asymmetric import ed25519
 
-def update_zip_manifest(zip_path: str, public_key_hex: str, checksum_hex: str, signature_hex: str):
+def update_zip_manifest(zip_path: str, public_key_hex: str, checksum_hex: str, signature_hex: str,
+                        signature_version: int):
     manifest_data = {}
 
     with zipfile.ZipFile(zip_path, 'r') as zin:
@@ -24,6 +25,7 @@ def update_zip_manifest(zip_path: str, public_key_hex: str, checksum_hex: str, s
     manifest_data["checksum"] = checksum_hex
     manifest_data["signature"] = signature_hex
     manifest_data["public_key"] = public_key_hex
+    manifest_data["signature_version"] = signature_version
 
     fd, temp_path = tempfile.mkstemp(suffix=".zip")
     os.close(fd)
@@ -57,14 +59,32 @@ def load_private_key(key_path: str, password: bytes = None):
         print(f"Error: Private key file not found at '{key_path}'")
         sys.exit(1)
 
+def signed_entries(zf: zipfile.ZipFile):
+    all_entries = zf.namelist()
+    filtered_files = [f for f in all_entries if not f.endswith('/') and f != 'manifest.json']
+    filtered_files.sort()
+    return filtered_files
+
+def calculate_o2r_tree_checksum(zip_path) -> bytes:
+    # Signature version 2: one BLAKE2b-512 leaf per file over (path, NUL, contents),
+    # then a BLAKE2b-512 over the leaves in sorted path order.
+    root = hashlib.blake2b()
+    with zipfile.ZipFile(zip_path, 'r') as zf:
+        for file_name in signed_entries(zf):
+            leaf = hashlib.blake2b()
+            leaf.update(file_name.encode('utf-8'))
+            leaf.update(b"\0")
+            with zf.open(file_name) as f:
+                for chunk in iter(lambda: f.read(65536), b""):
+                    leaf.update(chunk)
+            root.update(leaf.digest())
+
+    return root.digest()
+
 def calculate_o2r_checksum(zip_path) -> bytes:
     hasher = hashlib.blake2b()
     with zipfile.ZipFile(zip_path, 'r') as zf:
-        all_entries = zf.namelist()
-        filtered_files = [f for f in all_entries if not f.endswith('/') and f != 'manifest.json']
-        filtered_files.sort()
-
-        for file_name in filtered_files:
+        for file_name in signed_entries(zf):
             hasher.update(file_name.encode('utf-8'))
             with zf.open(file_name) as f:
                 for chunk in iter(lambda: f.read(8192), b""):
@@ -77,11 +97,16 @@ if __name__ == "__main__":
     parser.add_argument("zip_file", help="Path to the target .zip file")
     parser.add_argument("private_key", help="Path to the PEM private key")
     parser.add_argument("-p", "--passphrase", help="Passphrase for the PEM file", default=None)
+    parser.add_argument("-s", "--signature-version", help="Checksum layout: 1 = sequential, 2 = per-file tree",
+                        type=int, choices=[1, 2], default=2)
 
     args = parser.parse_args()
     print(f"Processing {args.zip_file}...")
 
-    raw_checksum = calculate_o2r_checksum(args.zip_file)
+    if args.signature_version == 2:
+        raw_checksum = calculate_o2r_tree_checksum(args.zip_file)
+    else:
+        raw_checksum = calculate_o2r_checksum(args.zip_file)
     hex_checksum = raw_checksum.hex()
 
     passphrase_bytes = args.passphrase.encode('utf-8') if args.passphrase else None
@@ -94,5 +119,5 @@ if __name__ == "__main__":
     )
     public_key_hex = raw_public_key.hex()
     signature_str = private_key.sign(raw_checksum).hex()
-    update_zip_manifest(args.zip_file, public_key_hex, hex_checksum, signature_str)
+    update_zip_manifest(args.zip_file, public_key_hex, hex_checksum, signature_str, args.signature_version)
     print("[SUCCESS] Zip signed successfully.")
\ No newline at end of file